@@ -16,6 +16,15 @@ graph_t *graph_create(void)
 
 	graph->nb_vertices = 0;
 	graph->vertices = NULL;
+	graph->tail = NULL;
+	graph->index = NULL;
+	graph->index_size = 0;
+	graph->flags = 0;
+	graph->slabs = NULL;
+	graph->edge_set = NULL;
+	graph->edge_set_size = 0;
+	graph->nb_edge_keys = 0;
+	graph->labels = NULL;
 
 	return (graph);
 
@@ -2,7 +2,8 @@
 #include <string.h>
 #include <stdlib.h>
 
-vertex_t *create_vertex(const char *str);
+vertex_t *create_vertex(graph_t *graph, const char *str, size_t hash,
+			size_t length);
 
 /**
  * graph_add_vertex - adds a vertex to the graph
@@ -12,48 +13,42 @@ vertex_t *create_vertex(const char *str);
  */
 vertex_t *graph_add_vertex(graph_t *graph, const char *str)
 {
-	vertex_t *vertex_ptr, *prev_vertex_ptr, *vertex;
+	vertex_t *vertex;
+	size_t hash, length;
 
 	if (graph == NULL || str == NULL)
 	{
 		return (NULL);
 	}
 
-	vertex_ptr = graph->vertices;
-
 	/* Check if the vertex with the str already exists */
-	while (vertex_ptr)
+	hash = graph_hash(str, &length);
+	if (graph_index_lookup(graph, str, hash, length) != NULL)
 	{
-		if (strcmp(vertex_ptr->content, str) == 0)
-		{
-			return (NULL);
-		}
-
-		prev_vertex_ptr = vertex_ptr;
-		vertex_ptr = vertex_ptr->next;
+		return (NULL);
 	}
 
 	/*Create a new vertex*/
-	vertex = create_vertex(str);
+	vertex = create_vertex(graph, str, hash, length);
 
 	if (vertex == NULL)
 	{
 		return (NULL);
 	}
 
+	if (graph_index_insert(graph, vertex) == 0)
+	{
+		graph_free(graph, vertex);
+		return (NULL);
+	}
 
 	if (graph->nb_vertices == 0)
-	{
 		graph->vertices = vertex;
-		vertex->index = 0;
-	}
 	else
-	{
-		prev_vertex_ptr->next = vertex;
-		vertex->index = prev_vertex_ptr->index + 1;
-	}
-
+		graph->tail->next = vertex;
 
+	vertex->index = graph->nb_vertices;
+	graph->tail = vertex;
 	graph->nb_vertices += 1;
 
 	return (vertex);
@@ -61,23 +56,62 @@ vertex_t *graph_add_vertex(graph_t *graph, const char *str)
 
 /**
  * create_vertex - create a new vertex
+ * @graph: pointer to the graph that will own the vertex
  * @str: string value for the new vertex
+ * @hash: the hash of @str
+ * @length: the length of @str
  * Return: a pointer to the new vertex
  */
-vertex_t *create_vertex(const char *str)
+vertex_t *create_vertex(graph_t *graph, const char *str, size_t hash,
+			size_t length)
 {
-	vertex_t *vertex = malloc(sizeof(vertex_t));
+	vertex_t *vertex = graph_alloc(graph, sizeof(vertex_t));
 
 	if (vertex == NULL)
 	{
 		return (NULL);
 	}
 
-	vertex->content = strdup(str);
+	if (graph_vertex_init(graph, vertex, str, hash, length) == 0)
+	{
+		graph_free(graph, vertex);
+		return (NULL);
+	}
+
+	return (vertex);
+}
+
+/**
+ * graph_vertex_init - sets up the memory of a new vertex
+ * Contents shorter than GRAPH_LABEL_INLINE are stored in the vertex itself,
+ * longer ones in the label pool of the graph
+ * @graph: pointer to the graph that will own the vertex
+ * @vertex: the memory of the vertex
+ * @str: string value for the new vertex
+ * @hash: the hash of @str
+ * @length: the length of @str
+ * Return: 1 on success, 0 on failure
+ */
+int graph_vertex_init(graph_t *graph, vertex_t *vertex, const char *str,
+		      size_t hash, size_t length)
+{
+	if (length < GRAPH_LABEL_INLINE)
+		vertex->content = memcpy(vertex->label, str, length + 1);
+	else
+		vertex->content = graph_intern(graph, str, length);
+
+	if (vertex->content == NULL)
+	{
+		return (0);
+	}
+
 	vertex->index = 0;
+	vertex->hash = hash;
+	vertex->length = length;
 	vertex->edges = NULL;
+	vertex->edges_tail = NULL;
 	vertex->nb_edges = 0;
 	vertex->next = NULL;
 
-	return (vertex);
+	return (1);
 }
@@ -1,43 +1,83 @@
 #include "graphs.h"
 
+/**
+ * graph_link_edge - appends an edge to the edge list of a vertex in O(1)
+ * through its tail pointer, and registers it in the edge set of the graph
+ * in GRAPH_UNIQUE_EDGES mode, room having been reserved there
+ * @graph: the graph owning the edge
+ * @src_vertex: the source vertex for the edge
+ * @edge: the edge to append, its destination already set
+ */
+
+void graph_link_edge(graph_t *graph, vertex_t *src_vertex, edge_t *edge)
+{
+	edge->next = NULL;
+
+	if (src_vertex->edges_tail)
+		src_vertex->edges_tail->next = edge;
+	else
+		src_vertex->edges = edge;
+
+	src_vertex->edges_tail = edge;
+	src_vertex->nb_edges++;
+
+	if (graph->flags & GRAPH_UNIQUE_EDGES)
+		graph_edge_set_insert(graph, src_vertex, edge->dest);
+}
+
 /**
  * graph_add_single_edge - program that adds a single directed edge to a vertex
+ * @graph: the graph that will own the edge
  * @src_vertex: the source vertex for the edge
  * @dest_vertex: the destination vertex for the edge
- * Return: a pointer to the created edge, or NULL on failure
+ * Return: a pointer to the created edge, or NULL on failure or if the edge
+ * already exists in GRAPH_UNIQUE_EDGES mode
  */
 
-edge_t *graph_add_single_edge(vertex_t *src_vertex, vertex_t *dest_vertex)
+edge_t *graph_add_single_edge(graph_t *graph, vertex_t *src_vertex,
+			      vertex_t *dest_vertex)
 {
-	edge_t *new_edge = NULL, *temp_edge = NULL;
+	edge_t *new_edge = NULL;
 
 	if (!src_vertex || !dest_vertex)
 		return (NULL);
 
-	new_edge = malloc(sizeof(edge_t));
+	if (graph->flags & GRAPH_UNIQUE_EDGES &&
+	    (graph_edge_set_find(graph, src_vertex, dest_vertex) ||
+	     !graph_edge_set_reserve(graph)))
+		return (NULL);
+
+	new_edge = graph_alloc(graph, sizeof(edge_t));
 
 	if (!new_edge)
 		return (NULL);
 
 	new_edge->dest = dest_vertex;
-	new_edge->next = NULL;
-
-	temp_edge = src_vertex->edges;
-
-	while (temp_edge && temp_edge->next)
-		temp_edge = temp_edge->next;
-
-	if (temp_edge)
-		temp_edge->next = new_edge;
-	else
-		src_vertex->edges = new_edge;
-
-	src_vertex->nb_edges++;
+	graph_link_edge(graph, src_vertex, new_edge);
 
 	return (new_edge);
 }
 
+/**
+ * graph_edge_is_duplicate - tells whether an edge counts as a duplicate
+ * in GRAPH_UNIQUE_EDGES mode
+ * A BIDIRECTIONAL edge is a duplicate if either of its directions exists
+ * @graph: the graph, in GRAPH_UNIQUE_EDGES mode
+ * @src_vertex: the source vertex of the edge
+ * @dest_vertex: the destination vertex of the edge
+ * @type: the type of the edge (UNIDIRECTIONAL or BIDIRECTIONAL)
+ * Return: 1 if the edge is a duplicate, 0 otherwise
+ */
 
+int graph_edge_is_duplicate(const graph_t *graph, const vertex_t *src_vertex,
+			    const vertex_t *dest_vertex, edge_type_t type)
+{
+	if (graph_edge_set_find(graph, src_vertex, dest_vertex))
+		return (1);
+
+	return (type == BIDIRECTIONAL &&
+		graph_edge_set_find(graph, dest_vertex, src_vertex) != NULL);
+}
 
 /**
  * graph_add_edge - program that adds an edge between vertices in the graph
@@ -45,36 +85,37 @@ edge_t *graph_add_single_edge(vertex_t *src_vertex, vertex_t *dest_vertex)
  * @src: the content of the source vertex
  * @dest: the content of the destination vertex
  * @type: the type of edge (UNIDIRECTIONAL or BIDIRECTIONAL)
- * Return: 1 on success, 0 on failure
+ * Return: 1 on success, 0 on failure, if @src and @dest are the same
+ * vertex, or if, in GRAPH_UNIQUE_EDGES mode, the edge is a duplicate as
+ * told by graph_edge_is_duplicate
  */
 
 int graph_add_edge(graph_t *graph, const char *src,
 		   const char *dest, edge_type_t type)
 {
-	vertex_t *temp_vertex = NULL, *src_vertex = NULL, *dest_vertex = NULL;
+	vertex_t *src_vertex = NULL, *dest_vertex = NULL;
 
 	if (!graph || !src || !dest ||
 	    type < UNIDIRECTIONAL || type > BIDIRECTIONAL)
 		return (0);
 
-	for (temp_vertex = graph->vertices; temp_vertex; temp_vertex =
-		     temp_vertex->next)
-	{
-		if (strcmp(temp_vertex->content, src) == 0)
-			src_vertex = temp_vertex;
-		else if (strcmp(temp_vertex->content, dest) == 0)
-			dest_vertex = temp_vertex;
-	}
+	src_vertex = graph_index_find(graph, src);
+	dest_vertex = graph_index_find(graph, dest);
 
-	if (!src_vertex || !dest_vertex)
+	if (!src_vertex || !dest_vertex || src_vertex == dest_vertex)
+		return (0);
+
+	if (graph->flags & GRAPH_UNIQUE_EDGES &&
+	    graph_edge_is_duplicate(graph, src_vertex, dest_vertex, type))
 		return (0);
 
-	if (graph_add_single_edge(src_vertex, dest_vertex) == NULL)
+	if (graph_add_single_edge(graph, src_vertex, dest_vertex) == NULL)
 		return (0);
 
 	if (type == BIDIRECTIONAL)
 	{
-		if (graph_add_single_edge(dest_vertex, src_vertex) == NULL)
+		if (graph_add_single_edge(graph, dest_vertex,
+					  src_vertex) == NULL)
 			return (0);
 	}
 
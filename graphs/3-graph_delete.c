@@ -14,27 +14,38 @@ void graph_delete(graph_t *graph)
 	if (!graph)
 		return;
 
+	if (graph->flags & GRAPH_ARENA)
+	{
+		graph_arena_delete(graph);
+		graph_labels_delete(graph);
+		free(graph->index);
+		free(graph->edge_set);
+		free(graph);
+		return;
+	}
+
 	current_vertex = graph->vertices;
 
 	while (current_vertex)
 	{
 		next_vertex = current_vertex->next;
 
-		if (current_vertex->content)
-			free(current_vertex->content);
-
 		current_edge = current_vertex->edges;
 
 		while (current_edge)
 		{
 			next_edge = current_edge->next;
-			free(current_edge);
+			graph_free(graph, current_edge);
 			current_edge = next_edge;
 		}
 
-		free(current_vertex);
+		graph_free(graph, current_vertex);
 		current_vertex = next_vertex;
 	}
 
+	graph_arena_delete(graph);
+	graph_labels_delete(graph);
+	free(graph->index);
+	free(graph->edge_set);
 	free(graph);
 }
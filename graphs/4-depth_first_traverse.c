@@ -1,85 +1,135 @@
 #include "graphs.h"
 
 /**
- * traverseVerticesRecursively - recursive function that travels through
- * vertices in a graph
- * @vertex: the starting vertex to traverse from
- * @visited_flags: an array indicating whether vertices have been visited
- * @current_depth: the current depth level in traversal
- * @vertex_action: a function to perform an action on each vertex
- * Return: the maximum depth reached during traversal
+ * dfs_push - pushes a vertex on the explicit stack of the traversal,
+ * doubling the stack when it is full
+ * @stack: a pointer to the stack
+ * @size: a pointer to the number of frames the stack can hold
+ * @top: the position of the new frame
+ * @vertex: the vertex to push
+ * Return: 1 on success, 0 on failure
  */
 
-size_t traverseVerticesRecursively(vertex_t *vertex, char *visited_flags,
-				   size_t current_depth, void (*vertex_action)
-				   (const vertex_t *v, size_t depth))
+static int dfs_push(dfs_frame_t **stack, size_t *size, size_t top,
+		    const vertex_t *vertex)
 {
-	size_t current_depth_new = 0, max_depth = current_depth, flag = 0;
-	edge_t *edge_header = NULL;
+	dfs_frame_t *grown;
 
-	if (!vertex)
-		return (current_depth - 1);
+	if (top == *size)
+	{
+		grown = realloc(*stack, *size * 2 * sizeof(dfs_frame_t));
+		if (!grown)
+			return (0);
+		STATS_ADD(bytes_allocated, *size * sizeof(dfs_frame_t));
+		*stack = grown;
+		*size *= 2;
+	}
+
+	(*stack)[top].vertex = vertex;
+	(*stack)[top].edge = vertex->edges;
+	STATS_ADD(vertices_visited, 1), STATS_PEAK(top + 1);
+
+	return (1);
+}
+
+/**
+ * traverse_from_root - iterative depth-first search from a single vertex
+ * @root: the starting vertex to traverse from, not visited yet
+ * @visited: a bitset of the vertices already visited
+ * @stack: a pointer to the explicit stack, grown as needed
+ * @size: a pointer to the number of frames the stack can hold
+ * @action: a function to perform an action on each vertex
+ * Return: the maximum depth reached from @root, or DFS_FAILED if the stack
+ * could not grow
+ */
 
-	edge_header = vertex->edges;
+static size_t traverse_from_root(const vertex_t *root,
+				 unsigned char *visited, dfs_frame_t **stack,
+				 size_t *size, void (*action)
+				 (const vertex_t *v, size_t depth))
+{
+	size_t top = 0, max_depth = 0;
+	const vertex_t *dest;
+	dfs_frame_t *frame;
+
+	BITSET_SET(visited, root->index);
+	action(root, 0);
+	if (!dfs_push(stack, size, 0, root))
+		return (DFS_FAILED);
 
-	while (edge_header)
+	while (1)
 	{
-		if (visited_flags[edge_header->dest->index] == 0)
+		frame = *stack + top;
+		if (!frame->edge)
 		{
-			vertex_action(edge_header->dest, current_depth);
-			visited_flags[edge_header->dest->index] = 1;
-			current_depth_new = traverseVerticesRecursively
-				(edge_header->dest, visited_flags,
-				 current_depth + 1, vertex_action);
-
-			if (current_depth_new > max_depth)
-				max_depth = current_depth_new;
-			flag = 1;
+			if (top-- == 0)
+				break;
+			continue;
 		}
-		edge_header = edge_header->next;
+		dest = frame->edge->dest;
+		frame->edge = frame->edge->next;
+		STATS_ADD(edges_scanned, 1);
+		if (BITSET_TEST(visited, dest->index))
+			continue;
+
+		BITSET_SET(visited, dest->index);
+		action(dest, top + 1);
+		if (!dfs_push(stack, size, top + 1, dest))
+			return (DFS_FAILED);
+		if (++top > max_depth)
+			max_depth = top;
 	}
-	if (flag)
-		return (max_depth);
 
-	return (max_depth - 1);
+	return (max_depth);
 }
 
-
-
 /**
  * depth_first_traverse - program that traverses a graph using
- * depth-first search
+ * depth-first search, starting a new search from every vertex that
+ * the previous ones did not reach
  * @graph: the graph to traverse
  * @action: a function to perform an action on each vertex along with its depth
- * Return: the maximum depth reached during traversal
+ * Return: the maximum depth reached during traversal, or 0 on failure
  */
 
 size_t depth_first_traverse(const graph_t *graph,
 			    void (*action)(const vertex_t *v, size_t depth))
 {
 	vertex_t *current_vertex = NULL;
-	char visited_flags[2048] = {0};
-	size_t current_depth = 0, max_depth = 0;
+	unsigned char *visited;
+	dfs_frame_t *stack;
+	size_t size = DFS_STACK_MIN_SIZE, depth, max_depth = 0;
 
 	if (!graph || !action)
 		return (0);
 
-	current_vertex = graph->vertices;
+	visited = calloc((graph->nb_vertices + 7) / 8, 1);
+	stack = malloc(size * sizeof(dfs_frame_t));
 
-	while (current_vertex)
+	if (visited && stack)
 	{
-		if (visited_flags[current_vertex->index] == 0)
+		STATS_BEGIN(GRAPH_PHASE_TRAVERSE);
+		STATS_ADD(bytes_allocated, (graph->nb_vertices + 7) / 8 +
+			  size * sizeof(dfs_frame_t));
+		for (current_vertex = graph->vertices; current_vertex;
+		     current_vertex = current_vertex->next)
 		{
-			action(current_vertex, 0);
-			visited_flags[current_vertex->index] = 1;
-			current_depth = traverseVerticesRecursively
-				(current_vertex, visited_flags, 1, action);
-
-			if (current_depth > max_depth)
-				max_depth = current_depth;
+			if (BITSET_TEST(visited, current_vertex->index))
+				continue;
+			depth = traverse_from_root(current_vertex, visited,
+						   &stack, &size, action);
+			if (depth == DFS_FAILED)
+			{
+				max_depth = 0;
+				break;
+			}
+			if (depth > max_depth)
+				max_depth = depth;
 		}
-		current_vertex = current_vertex->next;
-		break;
+		STATS_END(GRAPH_PHASE_TRAVERSE);
 	}
+
+	free(visited);
+	free(stack);
 	return (max_depth);
 }
@@ -1,98 +1,93 @@
 #include "graphs.h"
 
-/*@gogomillan*/
-
 /**
-* createqueue_t - A function that creates a queue
-* Return: queue created
+* queue_create - A function that creates an empty ring buffer queue
+* Return: queue created, or NULL on failure
 */
-queue_t *createqueue_t()
+queue_t *queue_create(void)
 {
 	queue_t *q = malloc(sizeof(queue_t));
 
-	q->front = -1;
-	q->rear = -1;
+	if (q == NULL)
+		return (NULL);
+	q->items = malloc(QUEUE_MIN_SIZE * sizeof(*q->items));
+	if (q->items == NULL)
+	{
+		free(q);
+		return (NULL);
+	}
+	q->capacity = QUEUE_MIN_SIZE;
+	q->front = 0;
+	q->size = 0;
 	return (q);
 }
 
 /**
-* enqueue - A function that appends the item in queue
+* queue_push_back - A function that appends a vertex to the queue,
+* doubling the ring buffer when it is full
 * @q: queue
-* @value: value to be stored
+* @vertex: vertex to be stored
+* Return: 1 on success, 0 on failure
 */
-void enqueue(queue_t *q, int value)
+int queue_push_back(queue_t *q, const vertex_t *vertex)
 {
-	if (q->rear == (SIZE - 1))
-		printf("\nqueue_t is Full!!");
-	else
+	const vertex_t **items;
+	size_t i;
+
+	if (q->size == q->capacity)
 	{
-		if (q->front == -1)
-			q->front = 0;
-		q->rear++;
-		q->items[q->rear] = value;
+		items = malloc(q->capacity * 2 * sizeof(*items));
+		if (items == NULL)
+			return (0);
+		STATS_ADD(bytes_allocated, q->capacity * 2 * sizeof(*items));
+		for (i = 0; i < q->size; i++)
+			items[i] = q->items[(q->front + i) & (q->capacity - 1)];
+		free(q->items);
+		q->items = items;
+		q->capacity *= 2;
+		q->front = 0;
 	}
+	q->items[(q->front + q->size) & (q->capacity - 1)] = vertex;
+	q->size++;
+	return (1);
 }
 
 /**
-* dequeue - A function that fetches first item in queue
+* queue_pop_front - A function that fetches first vertex in queue
 * @q: queue
-* @peek: whether to perform dequeue or just a peek
-* Return: first item in queue on success,  -1 on failure
+* Return: first vertex in queue, NULL if the queue is empty
 */
-int dequeue(queue_t *q, int peek)
+const vertex_t *queue_pop_front(queue_t *q)
 {
-	int item;
+	const vertex_t *vertex;
 
-	if (q->rear == -1)
-	{
-		printf("queue_t is empty");
-		item = -1;
-	}
-	else
-	{
-		if (peek)
-			return (q->items[q->front]);
-		item = q->items[q->front];
-		q->front++;
-		if (q->front > q->rear)
-		{
-			q->front = q->rear = -1;
-		}
-	}
-	return (item);
+	if (q->size == 0)
+		return (NULL);
+	vertex = q->items[q->front];
+	q->front = (q->front + 1) & (q->capacity - 1);
+	q->size--;
+	return (vertex);
 }
 
 /**
-* get_vertex_index - A function that fetches an vertex existing in graph by
-* index
-* @graph: A pointer to the graph
-* @index: The index identifying the vertex
-*
-* Return: vertex on success,  NULL on failure
+* queue_delete - A function that frees a queue
+* @q: queue
 */
-vertex_t *get_vertex_index(const graph_t *graph, size_t index)
+void queue_delete(queue_t *q)
 {
-	vertex_t *node;
-
-	if (index > graph->nb_vertices)
-		return (NULL);
-	node = graph->vertices;
-	if (node == NULL)
-		return (NULL);
-	while (node != NULL)
-	{
-		if (node->index == index)
-		{
-			return (node);
-		}
-		node = node->next;
-	}
-	return (NULL);
+	if (q == NULL)
+		return;
+	free(q->items);
+	free(q);
 }
 
 /**
 * breadth_first_traverse - A function that goes through a graph using the
 * breadth -first algorithm.
+* The queue holds the vertices themselves, and a level ends once as many
+* vertices as it held have been dequeued, so no sentinel is needed
+* A queue that fails to grow stops the traversal, as a partial one would
+* leave vertices unvisited while reporting a breadth
 * @graph: A pointer to the graph to traverse
 * @action: A  pointer to a function to be called for each visited vertex.
 * Return: The max breadth , or 0 on failure
@@ -100,43 +95,41 @@ vertex_t *get_vertex_index(const graph_t *graph, size_t index)
 size_t breadth_first_traverse(const graph_t *graph,
 							void (*action)(const vertex_t *v, size_t breadth))
 {
-	size_t breadth = 0, *visited;
-	int index = 0;
-
-	vertex_t *curr, *dest;
+	size_t breadth = 0, level_size = 1;
+	unsigned char *visited;
+	const vertex_t *curr;
 	edge_t *edge;
 	queue_t *q;
 
 	if (graph == NULL || graph->nb_vertices == 0 || graph->vertices == NULL)
 		return (0);
-	visited = calloc(graph->nb_vertices, sizeof(size_t)), q = createqueue_t();
-	curr = graph->vertices, enqueue(q, curr->index), enqueue(q, LEVELBREAK);
-	while (q->rear != -1)
+	visited = calloc((graph->nb_vertices + 7) / 8, 1), q = queue_create();
+	if (visited && q && queue_push_back(q, graph->vertices))
+		BITSET_SET(visited, graph->vertices->index);
+	STATS_BEGIN(GRAPH_PHASE_TRAVERSE);
+	while (visited && q && (curr = queue_pop_front(q)) != NULL)
 	{
-		index = dequeue(q, 0);
-		if (index == LEVELBREAK)
+		if (level_size-- == 0)
+			breadth++, level_size = q->size;
+		action(curr, breadth);
+		STATS_ADD(vertices_visited, 1);
+		STATS_ADD(edges_scanned, curr->nb_edges);
+		for (edge = curr->edges; edge; edge = edge->next)
 		{
-			breadth++;
-			enqueue(q, LEVELBREAK);
-			if (dequeue(q, 1) == LEVELBREAK)
+			if (BITSET_TEST(visited, edge->dest->index))
+				continue;
+			if (!queue_push_back(q, edge->dest))
 				break;
-			continue;
+			BITSET_SET(visited, edge->dest->index);
 		}
-		curr = get_vertex_index(graph, index);
-		if (visited[curr->index] != EXPLORED)
+		if (edge)
 		{
-			visited[curr->index] = EXPLORED;
-			action(curr, breadth);
-			edge = curr->edges;
-			while (edge)
-			{
-				dest = edge->dest;
-				if (dest && visited[dest->index] == UNEXPLORED)
-					enqueue(q, dest->index), visited[dest->index] = BACKTRACK;
-				edge = edge->next;
-			}
+			breadth = 0;
+			break;
 		}
+		STATS_PEAK(q->size);
 	}
-	free(visited), free(q);
-	return (breadth - 1);
+	STATS_END(GRAPH_PHASE_TRAVERSE);
+	free(visited), queue_delete(q);
+	return (breadth);
 }
@@ -0,0 +1,106 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "../graphs.h"
+
+#define BENCH_BATCH 1024
+#define BENCH_SOURCES 64
+#define BENCH_RMAT_A 0.57
+#define BENCH_RMAT_B 0.19
+#define BENCH_RMAT_C 0.19
+
+/**
+ * struct bench_edges_s - Generated graph, as an edge list over vertex
+ * indices, along with the names the vertices are added under
+ *
+ * @nb_vertices: Number of vertices
+ * @nb_edges: Number of edges
+ * @src: Source index of each edge
+ * @dest: Destination index of each edge
+ * @labels: Name of each vertex, formatted before any timing starts
+ * @buffer: Block holding every name
+ */
+typedef struct bench_edges_s
+{
+	size_t nb_vertices;
+	size_t nb_edges;
+	size_t *src;
+	size_t *dest;
+	char **labels;
+	char *buffer;
+} bench_edges_t;
+
+/**
+ * struct bench_options_s - Command line of the benchmark
+ *
+ * @generator: Name of the generator (er, rmat, grid, chain or star)
+ * @scale: The graph has about 2^@scale vertices
+ * @degree: Average out-degree of the er and rmat graphs
+ * @seed: Seed of the generator
+ * @reps: Number of repetitions of each timed operation
+ * @suites: Comma-separated suites to run
+ * @arena: Nonzero to build the graphs with graph_create_arena
+ */
+typedef struct bench_options_s
+{
+	const char *generator;
+	size_t scale;
+	size_t degree;
+	unsigned long seed;
+	size_t reps;
+	const char *suites;
+	int arena;
+} bench_options_t;
+
+/**
+ * struct bench_samples_s - Latency samples of one measurement
+ *
+ * @ns: Nanoseconds per item of each sample
+ * @size: Number of samples
+ * @capacity: Number of samples @ns can hold
+ * @seconds: Total time measured
+ * @items: Total number of items processed
+ */
+typedef struct bench_samples_s
+{
+	double *ns;
+	size_t size;
+	size_t capacity;
+	double seconds;
+	size_t items;
+} bench_samples_t;
+
+unsigned long bench_rand(unsigned long *state);
+bench_edges_t *bench_edges_create(size_t nb_vertices, size_t nb_edges);
+int bench_edges_label(bench_edges_t *edges);
+void bench_edges_delete(bench_edges_t *edges);
+bench_edges_t *bench_generate(const bench_options_t *options);
+bench_edges_t *bench_grid(size_t scale);
+bench_edges_t *bench_chain(size_t scale);
+bench_edges_t *bench_star(size_t scale);
+
+double bench_now(void);
+int bench_samples_init(bench_samples_t *samples, size_t capacity);
+void bench_samples_add(bench_samples_t *samples, double seconds,
+size_t items);
+void bench_report(const char *name, const char *unit,
+bench_samples_t *samples);
+void bench_report_size(const char *name, size_t bytes, size_t edges);
+void bench_json_begin(const bench_options_t *options,
+const bench_edges_t *edges);
+void bench_json_end(void);
+
+graph_t *bench_build(const bench_options_t *options,
+const bench_edges_t *edges, bench_samples_t *vertices,
+bench_samples_t *links);
+int bench_core(const bench_options_t *options, const bench_edges_t *edges);
+int bench_traversals(graph_csr_t *csr, size_t reps, const char *suffix);
+int bench_sources(const graph_csr_t *csr, size_t reps);
+int bench_csr(const bench_options_t *options, const bench_edges_t *edges);
+int bench_packed(const bench_options_t *options, const bench_edges_t *edges);
+int bench_parallel(const bench_options_t *options,
+const bench_edges_t *edges);
+int bench_reorder(const bench_options_t *options,
+const bench_edges_t *edges);
+
+#endif /*BENCH_H*/
@@ -0,0 +1,89 @@
+#include "bench.h"
+
+/**
+ * add_vertices - adds every vertex of an edge list to a graph by batches
+ * of BENCH_BATCH, timing each batch
+ * @graph: the graph
+ * @edges: the edge list
+ * @samples: the samples to record the batches in, may be NULL
+ * Return: 1 on success, 0 on failure
+ */
+
+static int add_vertices(graph_t *graph, const bench_edges_t *edges,
+			bench_samples_t *samples)
+{
+	size_t v, i, end;
+	double start;
+
+	for (v = 0; v < edges->nb_vertices; v = end)
+	{
+		end = v + BENCH_BATCH < edges->nb_vertices ?
+			v + BENCH_BATCH : edges->nb_vertices;
+		start = bench_now();
+		for (i = v; i < end; i++)
+			if (!graph_add_vertex(graph, edges->labels[i]))
+				return (0);
+		if (samples)
+			bench_samples_add(samples, bench_now() - start,
+					  end - v);
+	}
+	return (1);
+}
+
+/**
+ * add_edges - adds every edge of an edge list to a graph by name, by
+ * batches of BENCH_BATCH, timing each batch
+ * @graph: the graph, holding every vertex of @edges
+ * @edges: the edge list
+ * @samples: the samples to record the batches in, may be NULL
+ * Return: 1 on success, 0 on failure
+ */
+
+static int add_edges(graph_t *graph, const bench_edges_t *edges,
+		     bench_samples_t *samples)
+{
+	size_t e, i, end;
+	double start;
+
+	for (e = 0; e < edges->nb_edges; e = end)
+	{
+		end = e + BENCH_BATCH < edges->nb_edges ?
+			e + BENCH_BATCH : edges->nb_edges;
+		start = bench_now();
+		for (i = e; i < end; i++)
+			if (!graph_add_edge(graph, edges->labels[edges->src[i]],
+					    edges->labels[edges->dest[i]],
+					    UNIDIRECTIONAL))
+				return (0);
+		if (samples)
+			bench_samples_add(samples, bench_now() - start,
+					  end - e);
+	}
+	return (1);
+}
+
+/**
+ * bench_build - builds the graph of an edge list through the public API,
+ * in arena mode if the options ask for it
+ * @options: the options
+ * @edges: the edge list
+ * @vertices: the samples of graph_add_vertex, may be NULL
+ * @links: the samples of graph_add_edge, may be NULL
+ * Return: the graph, or NULL on failure
+ */
+
+graph_t *bench_build(const bench_options_t *options,
+		     const bench_edges_t *edges, bench_samples_t *vertices,
+		     bench_samples_t *links)
+{
+	graph_t *graph;
+
+	graph = options->arena ? graph_create_arena() : graph_create();
+	if (graph && (!add_vertices(graph, edges, vertices) ||
+		      !add_edges(graph, edges, links)))
+	{
+		graph_delete(graph);
+		graph = NULL;
+	}
+	return (graph);
+}
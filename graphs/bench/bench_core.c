@@ -0,0 +1,85 @@
+#include "bench.h"
+
+/**
+ * visit_noop - traversal action doing nothing, so that only the traversal
+ * itself is measured
+ * @v: the vertex
+ * @depth: its depth
+ */
+
+static void visit_noop(const vertex_t *v, size_t depth)
+{
+	(void)v;
+	(void)depth;
+}
+
+/**
+ * core_round - builds the graph once, traverses it both ways and deletes
+ * it, timing every step
+ * @options: the options
+ * @edges: the edge list
+ * @samples: the samples of graph_add_vertex, graph_add_edge,
+ * depth_first_traverse, breadth_first_traverse and graph_delete
+ * Return: 1 on success, 0 on failure
+ */
+
+static int core_round(const bench_options_t *options,
+		      const bench_edges_t *edges, bench_samples_t *samples)
+{
+	graph_t *graph;
+	double start;
+
+	graph = bench_build(options, edges, samples, samples + 1);
+	if (!graph)
+		return (0);
+	start = bench_now();
+	depth_first_traverse(graph, visit_noop);
+	bench_samples_add(samples + 2, bench_now() - start, edges->nb_edges);
+	start = bench_now();
+	breadth_first_traverse(graph, visit_noop);
+	bench_samples_add(samples + 3, bench_now() - start, edges->nb_edges);
+	start = bench_now();
+	graph_delete(graph);
+	bench_samples_add(samples + 4, bench_now() - start,
+			  edges->nb_vertices);
+	return (1);
+}
+
+/**
+ * bench_core - the core suite: builds, traverses and deletes the graph
+ * through the graph_t API, options->reps times
+ * Insertions are sampled by batches of BENCH_BATCH, the rest by run;
+ * traversals are measured in edges of the graph per second
+ * @options: the options
+ * @edges: the edge list
+ * Return: 1 on success, 0 on failure
+ */
+
+int bench_core(const bench_options_t *options, const bench_edges_t *edges)
+{
+	static const char * const names[] = {
+		"graph_add_vertex", "graph_add_edge", "depth_first_traverse",
+		"breadth_first_traverse", "graph_delete"
+	};
+	static const char * const units[] = {
+		"vertices", "edges", "edges", "edges", "vertices"
+	};
+	bench_samples_t samples[5];
+	size_t r, i;
+	int ok = 1;
+
+	ok &= bench_samples_init(samples, options->reps *
+				 (edges->nb_vertices / BENCH_BATCH + 1));
+	ok &= bench_samples_init(samples + 1, options->reps *
+				 (edges->nb_edges / BENCH_BATCH + 1));
+	for (i = 2; i < 5; i++)
+		ok &= bench_samples_init(samples + i, options->reps);
+	for (r = 0; ok && r < options->reps; r++)
+		ok = core_round(options, edges, samples);
+	for (i = 0; i < 5; i++)
+		if (ok)
+			bench_report(names[i], units[i], samples + i);
+		else
+			free(samples[i].ns);
+	return (ok);
+}
@@ -0,0 +1,92 @@
+#include "bench.h"
+
+/**
+ * visit_noop - traversal action doing nothing
+ * @csr: the snapshot
+ * @v: the vertex
+ * @depth: its depth
+ */
+
+static void visit_noop(const graph_csr_t *csr, size_t v, size_t depth)
+{
+	(void)csr;
+	(void)v;
+	(void)depth;
+}
+
+/**
+ * bench_traversals - times the single-source traversals of a snapshot
+ * The reverse adjacency is built first, so the direction-optimizing BFS
+ * is timed without it
+ * @csr: the snapshot
+ * @reps: the number of runs of each traversal
+ * @suffix: appended to the names of the measurements
+ * Return: 1 on success, 0 on failure
+ */
+
+int bench_traversals(graph_csr_t *csr, size_t reps, const char *suffix)
+{
+	static const char * const names[] = {
+		"depth_first_traverse_csr", "breadth_first_traverse_csr",
+		"breadth_first_traverse_do"
+	};
+	bench_samples_t samples;
+	char name[64];
+	double start;
+	size_t i, r;
+
+	if (!graph_csr_add_reverse(csr))
+		return (0);
+	for (i = 0; i < 3; i++)
+	{
+		if (!bench_samples_init(&samples, reps))
+			return (0);
+		for (r = 0; r < reps; r++)
+		{
+			start = bench_now();
+			if (i == 0)
+				depth_first_traverse_csr(csr, visit_noop);
+			else if (i == 1)
+				breadth_first_traverse_csr(csr, visit_noop);
+			else
+				breadth_first_traverse_do(csr, visit_noop);
+			bench_samples_add(&samples, bench_now() - start,
+					  csr->nb_edges);
+		}
+		sprintf(name, "%s%s", names[i], suffix);
+		bench_report(name, "edges", &samples);
+	}
+	return (1);
+}
+
+/**
+ * bench_csr - the snapshot suite: times graph_freeze, then the CSR
+ * traversals, then the multi-source BFS against single-source runs
+ * @options: the options
+ * @edges: the edge list
+ * Return: 1 on success, 0 on failure
+ */
+
+int bench_csr(const bench_options_t *options, const bench_edges_t *edges)
+{
+	bench_samples_t samples;
+	graph_csr_t *csr;
+	graph_t *graph;
+	double start;
+	int ok;
+
+	graph = bench_build(options, edges, NULL, NULL);
+	if (!graph || !bench_samples_init(&samples, 1))
+		return (graph_delete(graph), 0);
+	start = bench_now();
+	csr = graph_freeze(graph);
+	bench_samples_add(&samples, bench_now() - start, edges->nb_edges);
+	graph_delete(graph);
+	if (!csr)
+		return (free(samples.ns), 0);
+	bench_report("graph_freeze", "edges", &samples);
+	ok = bench_traversals(csr, options->reps, "") &&
+		bench_sources(csr, options->reps);
+	graph_csr_delete(csr);
+	return (ok);
+}
@@ -0,0 +1,80 @@
+#include "bench.h"
+
+/**
+ * bench_rand - splitmix64 pseudo-random generator, so that a seed gives the
+ * same graph on every platform
+ * @state: a pointer to the state of the generator
+ * Return: the next 64-bit pseudo-random number
+ */
+
+unsigned long bench_rand(unsigned long *state)
+{
+	unsigned long z = (*state += 0x9E3779B97F4A7C15UL);
+
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9UL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBUL;
+	return (z ^ (z >> 31));
+}
+
+/**
+ * bench_edges_create - allocates an edge list
+ * @nb_vertices: the number of vertices
+ * @nb_edges: the number of edges
+ * Return: the edge list, without labels yet, or NULL on failure
+ */
+
+bench_edges_t *bench_edges_create(size_t nb_vertices, size_t nb_edges)
+{
+	bench_edges_t *edges = calloc(1, sizeof(*edges));
+
+	if (!edges)
+		return (NULL);
+	edges->nb_vertices = nb_vertices;
+	edges->nb_edges = nb_edges;
+	edges->src = malloc((nb_edges + 1) * sizeof(size_t));
+	edges->dest = malloc((nb_edges + 1) * sizeof(size_t));
+	if (!edges->src || !edges->dest)
+	{
+		bench_edges_delete(edges);
+		return (NULL);
+	}
+	return (edges);
+}
+
+/**
+ * bench_edges_label - formats the name of every vertex, its decimal index
+ * @edges: the edge list
+ * Return: 1 on success, 0 on failure
+ */
+
+int bench_edges_label(bench_edges_t *edges)
+{
+	size_t v, at = 0, width = 21;
+
+	edges->labels = malloc((edges->nb_vertices + 1) * sizeof(char *));
+	edges->buffer = malloc(edges->nb_vertices * width + 1);
+	if (!edges->labels || !edges->buffer)
+		return (0);
+	for (v = 0; v < edges->nb_vertices; v++)
+	{
+		edges->labels[v] = edges->buffer + at;
+		at += sprintf(edges->buffer + at, "%lu", (unsigned long)v) + 1;
+	}
+	return (1);
+}
+
+/**
+ * bench_edges_delete - frees an edge list
+ * @edges: the edge list, may be NULL
+ */
+
+void bench_edges_delete(bench_edges_t *edges)
+{
+	if (!edges)
+		return;
+	free(edges->src);
+	free(edges->dest);
+	free(edges->labels);
+	free(edges->buffer);
+	free(edges);
+}
@@ -0,0 +1,110 @@
+#include "bench.h"
+
+/**
+ * bench_er - generates an Erdos-Renyi G(n, m) graph, every edge joining
+ * two distinct vertices drawn uniformly, as graph_add_edge rejects
+ * self-loops
+ * @scale: the graph has 2^@scale vertices
+ * @degree: the average out-degree
+ * @seed: the seed of the generator
+ * Return: the edge list, or NULL on failure
+ */
+
+static bench_edges_t *bench_er(size_t scale, size_t degree,
+			       unsigned long seed)
+{
+	size_t n = (size_t)1 << scale, e;
+	bench_edges_t *edges = bench_edges_create(n, n * degree);
+
+	for (e = 0; edges && e < edges->nb_edges; e++)
+	{
+		do {
+			edges->src[e] = bench_rand(&seed) % n;
+			edges->dest[e] = bench_rand(&seed) % n;
+		} while (edges->src[e] == edges->dest[e]);
+	}
+	return (edges);
+}
+
+/**
+ * rmat_vertex - draws the quadrant of an R-MAT edge level by level
+ * @scale: the number of levels
+ * @seed: a pointer to the state of the generator
+ * @src: a pointer set to the source of the edge
+ * @dest: a pointer set to the destination of the edge
+ */
+
+static void rmat_vertex(size_t scale, unsigned long *seed, size_t *src,
+			size_t *dest)
+{
+	size_t level;
+	double p;
+
+	*src = *dest = 0;
+	for (level = 0; level < scale; level++)
+	{
+		p = (bench_rand(seed) >> 11) * (1.0 / 9007199254740992.0);
+		*src <<= 1, *dest <<= 1;
+		if (p >= BENCH_RMAT_A + BENCH_RMAT_B + BENCH_RMAT_C)
+			*src |= 1, *dest |= 1;
+		else if (p >= BENCH_RMAT_A + BENCH_RMAT_B)
+			*src |= 1;
+		else if (p >= BENCH_RMAT_A)
+			*dest |= 1;
+	}
+}
+
+/**
+ * bench_rmat - generates an R-MAT (Kronecker) graph, with the skewed
+ * degrees and small diameter of social and web graphs; a self-loop is
+ * drawn again, as graph_add_edge rejects them
+ * @scale: the graph has 2^@scale vertices
+ * @degree: the average out-degree
+ * @seed: the seed of the generator
+ * Return: the edge list, or NULL on failure
+ */
+
+static bench_edges_t *bench_rmat(size_t scale, size_t degree,
+				 unsigned long seed)
+{
+	size_t n = (size_t)1 << scale, e;
+	bench_edges_t *edges = bench_edges_create(n, n * degree);
+
+	for (e = 0; edges && e < edges->nb_edges; e++)
+		do {
+			rmat_vertex(scale, &seed, edges->src + e,
+				    edges->dest + e);
+		} while (edges->src[e] == edges->dest[e]);
+	return (edges);
+}
+
+/**
+ * bench_generate - generates the graph named by the options, with labels
+ * @options: the options
+ * Return: the edge list, or NULL on failure or for an unknown generator
+ */
+
+bench_edges_t *bench_generate(const bench_options_t *options)
+{
+	bench_edges_t *edges = NULL;
+	const char *name = options->generator;
+
+	if (!strcmp(name, "er"))
+		edges = bench_er(options->scale, options->degree,
+				 options->seed);
+	else if (!strcmp(name, "rmat"))
+		edges = bench_rmat(options->scale, options->degree,
+				   options->seed);
+	else if (!strcmp(name, "grid"))
+		edges = bench_grid(options->scale);
+	else if (!strcmp(name, "chain"))
+		edges = bench_chain(options->scale);
+	else if (!strcmp(name, "star"))
+		edges = bench_star(options->scale);
+	if (edges && !bench_edges_label(edges))
+	{
+		bench_edges_delete(edges);
+		edges = NULL;
+	}
+	return (edges);
+}
@@ -0,0 +1,99 @@
+#include <sys/resource.h>
+#include "bench.h"
+
+static int bench_first;
+
+/**
+ * ns_ascending - qsort comparator of doubles
+ * @a: a pointer to the first double
+ * @b: a pointer to the second double
+ * Return: negative, zero or positive as for qsort
+ */
+
+static int ns_ascending(const void *a, const void *b)
+{
+	double x = *(const double *)a, y = *(const double *)b;
+
+	return (x < y ? -1 : x > y);
+}
+
+/**
+ * bench_report - prints a measurement as an element of the results array,
+ * then frees its samples
+ * Latencies are nanoseconds per item, the percentiles being taken over
+ * the samples (whole runs, or batches of BENCH_BATCH insertions)
+ * @name: the name of the measurement
+ * @unit: what an item is, "edges" or "vertices"
+ * @samples: the samples
+ */
+
+void bench_report(const char *name, const char *unit,
+		  bench_samples_t *samples)
+{
+	double *ns = samples->ns;
+	size_t n = samples->size;
+
+	qsort(ns, n, sizeof(double), ns_ascending);
+	printf("%s\n    {\"name\": \"%s\", \"unit\": \"%s\", \"samples\": %lu",
+	       bench_first ? "" : ",", name, unit, (unsigned long)n);
+	printf(", \"seconds\": %.6f, \"throughput\": %.1f", samples->seconds,
+	       samples->seconds > 0 ? samples->items / samples->seconds : 0);
+	if (n > 0)
+		printf(", \"p50_ns\": %.2f, \"p90_ns\": %.2f, \"p99_ns\": %.2f"
+		       ", \"max_ns\": %.2f", ns[n / 2], ns[n * 9 / 10],
+		       ns[n * 99 / 100], ns[n - 1]);
+	printf("}");
+	bench_first = 0;
+	free(ns);
+	samples->ns = NULL, samples->size = samples->capacity = 0;
+}
+
+/**
+ * bench_report_size - prints the memory footprint of a representation as
+ * an element of the results array
+ * @name: the name of the representation
+ * @bytes: its size in bytes
+ * @edges: the number of edges it holds
+ */
+
+void bench_report_size(const char *name, size_t bytes, size_t edges)
+{
+	printf("%s\n    {\"name\": \"%s\", \"unit\": \"bytes\", \"bytes\": %lu"
+	       ", \"bytes_per_edge\": %.2f}", bench_first ? "" : ",", name,
+	       (unsigned long)bytes, edges ? (double)bytes / edges : 0);
+	bench_first = 0;
+}
+
+/**
+ * bench_json_begin - opens the JSON document and its results array
+ * @options: the options of the run
+ * @edges: the generated graph
+ */
+
+void bench_json_begin(const bench_options_t *options,
+		      const bench_edges_t *edges)
+{
+	printf("{\n  \"generator\": \"%s\", \"scale\": %lu, \"seed\": %lu,\n",
+	       options->generator, (unsigned long)options->scale,
+	       options->seed);
+	printf("  \"vertices\": %lu, \"edges\": %lu, \"arena\": %d, ",
+	       (unsigned long)edges->nb_vertices,
+	       (unsigned long)edges->nb_edges, options->arena);
+	printf("\"reps\": %lu,\n  \"results\": [",
+	       (unsigned long)options->reps);
+	bench_first = 1;
+}
+
+/**
+ * bench_json_end - closes the results array with the peak resident set
+ * size of the whole run, and the JSON document
+ */
+
+void bench_json_end(void)
+{
+	struct rusage usage;
+
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+		usage.ru_maxrss = 0;
+	printf("\n  ],\n  \"peak_rss_kb\": %ld\n}\n", (long)usage.ru_maxrss);
+}
@@ -0,0 +1,94 @@
+#include "bench.h"
+
+/**
+ * usage - prints the usage of the benchmark
+ * @name: the name of the program
+ * Return: EXIT_FAILURE
+ */
+
+static int usage(const char *name)
+{
+	fprintf(stderr, "Usage: %s [-g er|rmat|grid|chain|star] [-s scale]"
+		" [-d degree] [-S seed] [-r reps] [-a]\n"
+		"          [-u core,csr,packed,parallel,reorder]\n", name);
+	return (EXIT_FAILURE);
+}
+
+/**
+ * parse_options - reads the command line
+ * @ac: the number of arguments
+ * @av: the arguments
+ * @options: the options to fill in, defaults already set
+ * Return: 1 on success, 0 on an invalid command line
+ */
+
+static int parse_options(int ac, char **av, bench_options_t *options)
+{
+	int i;
+
+	for (i = 1; i < ac; i++)
+	{
+		if (!strcmp(av[i], "-a"))
+			options->arena = 1;
+		else if (i + 1 == ac || av[i][0] != '-' || !av[i][1] ||
+			 av[i][2])
+			return (0);
+		else if (av[i][1] == 'g')
+			options->generator = av[++i];
+		else if (av[i][1] == 's')
+			options->scale = strtoul(av[++i], NULL, 10);
+		else if (av[i][1] == 'd')
+			options->degree = strtoul(av[++i], NULL, 10);
+		else if (av[i][1] == 'S')
+			options->seed = strtoul(av[++i], NULL, 10);
+		else if (av[i][1] == 'r')
+			options->reps = strtoul(av[++i], NULL, 10);
+		else if (av[i][1] == 'u')
+			options->suites = av[++i];
+		else
+			return (0);
+	}
+	return (options->scale > 0 && options->scale < 40 &&
+		options->reps > 0);
+}
+
+/**
+ * main - generates a seeded synthetic graph and runs the benchmark suites
+ * on it, printing the measurements as a JSON document on stdout
+ * @ac: the number of arguments
+ * @av: the arguments
+ * Return: EXIT_SUCCESS, or EXIT_FAILURE on failure
+ */
+
+int main(int ac, char **av)
+{
+	bench_options_t options = {"rmat", 16, 8, 1, 5, "core", 0};
+	bench_edges_t *edges;
+	int ok = 1;
+
+	if (!parse_options(ac, av, &options))
+		return (usage(av[0]));
+	edges = bench_generate(&options);
+	if (!edges)
+	{
+		fprintf(stderr, "Cannot generate a %s graph\n",
+			options.generator);
+		return (usage(av[0]));
+	}
+	bench_json_begin(&options, edges);
+	if (strstr(options.suites, "core"))
+		ok = ok && bench_core(&options, edges);
+	if (strstr(options.suites, "csr"))
+		ok = ok && bench_csr(&options, edges);
+	if (strstr(options.suites, "packed"))
+		ok = ok && bench_packed(&options, edges);
+	if (strstr(options.suites, "parallel"))
+		ok = ok && bench_parallel(&options, edges);
+	if (strstr(options.suites, "reorder"))
+		ok = ok && bench_reorder(&options, edges);
+	bench_json_end();
+	bench_edges_delete(edges);
+	if (!ok)
+		fprintf(stderr, "Benchmark failed\n");
+	return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,82 @@
+#include "bench.h"
+
+/* Out-degrees summed by visit_scanned since the last reset */
+static size_t bench_scanned;
+
+/**
+ * visit_scanned - traversal action adding the out-degree of each vertex
+ * to bench_scanned, that is the edges the search scans from it
+ * @csr: the snapshot
+ * @v: the vertex
+ * @depth: its depth
+ */
+
+static void visit_scanned(const graph_csr_t *csr, size_t v, size_t depth)
+{
+	(void)depth;
+	bench_scanned += csr->offsets[v + 1] - csr->offsets[v];
+}
+
+/**
+ * multi_scanned - counts the edges the searches of a multi-source BFS
+ * scanned, the out-degrees of the vertices each one reached
+ * @csr: the snapshot
+ * @depths: the rows returned by breadth_first_traverse_multi
+ * @nb_sources: the number of rows
+ * Return: the number of edges
+ */
+
+static size_t multi_scanned(const graph_csr_t *csr, const size_t *depths,
+			    size_t nb_sources)
+{
+	size_t i, v, edges = 0;
+
+	for (i = 0; i < nb_sources; i++, depths += csr->nb_vertices)
+		for (v = 0; v < csr->nb_vertices; v++)
+			if (depths[v] != PBFS_UNVISITED)
+				edges += csr->offsets[v + 1] - csr->offsets[v];
+	return (edges);
+}
+
+/**
+ * bench_sources - compares one bit-parallel BFS from BENCH_SOURCES
+ * sources with BENCH_SOURCES runs of the single-source BFS from the same
+ * sources, each credited with the edges its searches reached and scanned
+ * breadth_first_traverse_multi costs one adjacency scan per level of the
+ * deepest search, so on graphs of high diameter the plain runs can win
+ * @csr: the snapshot
+ * @reps: the number of runs of each
+ * Return: 1 on success, 0 on failure
+ */
+
+int bench_sources(const graph_csr_t *csr, size_t reps)
+{
+	size_t sources[BENCH_SOURCES], *depths, edges, i, r;
+	bench_samples_t samples[2];
+	double start, ns;
+
+	for (i = 0; i < BENCH_SOURCES; i++)
+		sources[i] = i * (csr->nb_vertices / BENCH_SOURCES);
+	if (!bench_samples_init(samples, reps) ||
+	    !bench_samples_init(samples + 1, reps))
+		return (free(samples[0].ns), 0);
+	for (r = 0; r < reps; r++)
+	{
+		start = bench_now();
+		depths = breadth_first_traverse_multi(csr, sources,
+						      BENCH_SOURCES);
+		ns = bench_now() - start;
+		edges = depths ? multi_scanned(csr, depths, BENCH_SOURCES) : 0;
+		bench_samples_add(samples, ns, edges);
+		free(depths);
+		bench_scanned = 0, start = bench_now();
+		for (i = 0; i < BENCH_SOURCES; i++)
+			breadth_first_traverse_csr_from(csr, sources[i],
+							visit_scanned);
+		bench_samples_add(samples + 1, bench_now() - start,
+				  bench_scanned);
+	}
+	bench_report("breadth_first_traverse_multi_x64", "edges", samples);
+	bench_report("breadth_first_traverse_csr_64x1", "edges", samples + 1);
+	return (1);
+}
@@ -0,0 +1,121 @@
+#include "bench.h"
+
+/**
+ * visit_noop - traversal action doing nothing
+ * @packed: the snapshot
+ * @v: the vertex
+ * @depth: its depth
+ */
+
+static void visit_noop(const graph_packed_t *packed, size_t v, size_t depth)
+{
+	(void)packed;
+	(void)v;
+	(void)depth;
+}
+
+/**
+ * packed_traversals - times the traversals of a delta-compressed snapshot
+ * @packed: the snapshot
+ * @reps: the number of runs of each traversal
+ * @suffix: appended to the names of the measurements
+ * Return: 1 on success, 0 on failure
+ */
+
+static int packed_traversals(const graph_packed_t *packed, size_t reps,
+			     const char *suffix)
+{
+	bench_samples_t samples;
+	char name[64];
+	double start;
+	size_t i, r;
+
+	for (i = 0; i < 2; i++)
+	{
+		if (!bench_samples_init(&samples, reps))
+			return (0);
+		for (r = 0; r < reps; r++)
+		{
+			start = bench_now();
+			if (i == 0)
+				depth_first_traverse_packed(packed, visit_noop);
+			else
+				breadth_first_traverse_packed(packed,
+							      visit_noop);
+			bench_samples_add(&samples, bench_now() - start,
+					  packed->nb_edges);
+		}
+		sprintf(name, "%s_first_traverse_packed%s",
+			i == 0 ? "depth" : "breadth", suffix);
+		bench_report(name, "edges", &samples);
+	}
+	return (1);
+}
+
+/**
+ * packed_sizes - prints the size of the adjacency of a graph as edge
+ * lists, as a snapshot and as a delta-compressed snapshot
+ * @csr: the snapshot
+ * @packed: the delta-compressed snapshot
+ * @suffix: appended to the names of the measurements
+ */
+
+static void packed_sizes(const graph_csr_t *csr, const graph_packed_t *packed,
+			 const char *suffix)
+{
+	char name[64];
+
+	sprintf(name, "adjacency_edge_lists%s", suffix);
+	bench_report_size(name, csr->nb_edges * sizeof(edge_t), csr->nb_edges);
+	sprintf(name, "adjacency_csr%s", suffix);
+	bench_report_size(name, (csr->nb_vertices + 1 + csr->nb_edges) *
+			  sizeof(size_t), csr->nb_edges);
+	sprintf(name, "adjacency_packed%s", suffix);
+	bench_report_size(name, (packed->nb_vertices + 1) * sizeof(size_t) +
+			  packed->size, packed->nb_edges);
+}
+
+/**
+ * bench_packed - the compression suite: in insertion order then in
+ * reverse Cuthill-McKee order, times graph_csr_pack, prints the size of
+ * each representation of the adjacency, then times the traversals of
+ * the delta-compressed snapshot
+ * @options: the options
+ * @edges: the edge list
+ * Return: 1 on success, 0 on failure
+ */
+
+int bench_packed(const bench_options_t *options, const bench_edges_t *edges)
+{
+	static const char * const names[] = {"", "_rcm"};
+	bench_samples_t samples;
+	graph_packed_t *packed = NULL;
+	graph_csr_t *csr = NULL;
+	graph_t *graph;
+	char name[64];
+	double start;
+	int i, ok = 1;
+
+	for (i = 0; ok && i < 2; i++)
+	{
+		graph = bench_build(options, edges, NULL, NULL);
+		ok = graph && (i == 0 || graph_reorder(graph, GRAPH_ORDER_RCM));
+		csr = ok ? graph_freeze(graph) : NULL;
+		graph_delete(graph);
+		if (!csr || !bench_samples_init(&samples, 1))
+			return (graph_csr_delete(csr), 0);
+		start = bench_now();
+		packed = graph_csr_pack(csr);
+		bench_samples_add(&samples, bench_now() - start,
+				  edges->nb_edges);
+		sprintf(name, "graph_csr_pack%s", names[i]);
+		bench_report(name, "edges", &samples);
+		if (packed)
+			packed_sizes(csr, packed, names[i]);
+		graph_csr_delete(csr);
+		ok = packed && packed_traversals(packed, options->reps,
+						 names[i]);
+		graph_packed_delete(packed);
+	}
+	return (ok);
+}
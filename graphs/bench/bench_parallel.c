@@ -0,0 +1,74 @@
+#include "bench.h"
+
+/**
+ * bench_threads - times the parallel BFS or the connected components of a
+ * snapshot with a given number of threads
+ * @csr: the snapshot
+ * @reps: the number of runs
+ * @nb_threads: the number of threads
+ * @components: nonzero for graph_connected_components, zero for
+ * breadth_first_traverse_parallel
+ * Return: 1 on success, 0 on failure
+ */
+
+static int bench_threads(const graph_csr_t *csr, size_t reps,
+			 size_t nb_threads, int components)
+{
+	size_t *levels, *parents, r;
+	bench_samples_t samples;
+	char name[64];
+	double start;
+
+	levels = malloc(csr->nb_vertices * sizeof(size_t));
+	parents = malloc(csr->nb_vertices * sizeof(size_t));
+	if (!levels || !parents || !bench_samples_init(&samples, reps))
+		return (free(levels), free(parents), 0);
+	for (r = 0; r < reps; r++)
+	{
+		start = bench_now();
+		if (components)
+			free(graph_connected_components(csr, nb_threads));
+		else
+			breadth_first_traverse_parallel(csr, nb_threads, levels,
+							parents);
+		bench_samples_add(&samples, bench_now() - start,
+				  csr->nb_edges);
+	}
+	sprintf(name, "%s_t%lu", components ? "graph_connected_components" :
+		"breadth_first_traverse_parallel", (unsigned long)nb_threads);
+	bench_report(name, "edges", &samples);
+	free(levels), free(parents);
+	return (1);
+}
+
+/**
+ * bench_parallel - the scaling suite: the parallel BFS and the connected
+ * components of the snapshot with 1, 4, 16 and 32 threads
+ * @options: the options
+ * @edges: the edge list
+ * Return: 1 on success, 0 on failure
+ */
+
+int bench_parallel(const bench_options_t *options,
+		   const bench_edges_t *edges)
+{
+	static const size_t threads[] = {1, 4, 16, 32};
+	graph_csr_t *csr;
+	graph_t *graph;
+	size_t i;
+	int ok = 1, components;
+
+	graph = bench_build(options, edges, NULL, NULL);
+	if (!graph)
+		return (0);
+	csr = graph_freeze(graph);
+	graph_delete(graph);
+	if (!csr)
+		return (0);
+	for (components = 0; components < 2; components++)
+		for (i = 0; ok && i < sizeof(threads) / sizeof(*threads); i++)
+			ok = bench_threads(csr, options->reps, threads[i],
+					   components);
+	graph_csr_delete(csr);
+	return (ok);
+}
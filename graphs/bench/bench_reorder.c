@@ -0,0 +1,46 @@
+#include "bench.h"
+
+/**
+ * bench_reorder - the locality suite: for each vertex order, builds the
+ * graph, times graph_reorder, then the traversals of its snapshot, whose
+ * names are suffixed with the order ("_none" for insertion order)
+ * @options: the options
+ * @edges: the edge list
+ * Return: 1 on success, 0 on failure
+ */
+
+int bench_reorder(const bench_options_t *options,
+		  const bench_edges_t *edges)
+{
+	static const char * const names[] = {
+		"_none", "_rcm", "_degree", "_bfs"
+	};
+	bench_samples_t samples;
+	graph_csr_t *csr;
+	graph_t *graph;
+	char name[64];
+	double start;
+	int strategy, ok = 1;
+
+	for (strategy = -1; ok && strategy <= GRAPH_ORDER_BFS; strategy++)
+	{
+		graph = bench_build(options, edges, NULL, NULL);
+		if (!graph || !bench_samples_init(&samples, 1))
+			return (graph_delete(graph), 0);
+		start = bench_now();
+		ok = strategy < 0 || graph_reorder(graph, strategy);
+		bench_samples_add(&samples, bench_now() - start,
+				  edges->nb_vertices);
+		csr = ok ? graph_freeze(graph) : NULL;
+		graph_delete(graph);
+		sprintf(name, "graph_reorder%s", names[strategy + 1]);
+		if (strategy >= 0)
+			bench_report(name, "vertices", &samples);
+		else
+			free(samples.ns);
+		ok = csr && bench_traversals(csr, options->reps,
+					     names[strategy + 1]);
+		graph_csr_delete(csr);
+	}
+	return (ok);
+}
@@ -0,0 +1,50 @@
+#include <time.h>
+#include "bench.h"
+
+/**
+ * bench_now - reads the monotonic clock
+ * Return: the current time in seconds
+ */
+
+double bench_now(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec + now.tv_nsec / 1e9);
+}
+
+/**
+ * bench_samples_init - sets up an empty set of samples
+ * @samples: the samples
+ * @capacity: the number of samples to make room for
+ * Return: 1 on success, 0 on failure
+ */
+
+int bench_samples_init(bench_samples_t *samples, size_t capacity)
+{
+	samples->ns = malloc((capacity ? capacity : 1) * sizeof(double));
+	samples->size = 0;
+	samples->capacity = samples->ns ? capacity : 0;
+	samples->seconds = 0;
+	samples->items = 0;
+	return (samples->ns != NULL);
+}
+
+/**
+ * bench_samples_add - records a timed run over a number of items; runs
+ * beyond the capacity count towards the throughput only
+ * @samples: the samples
+ * @seconds: the duration of the run
+ * @items: the number of items (vertices, edges...) the run processed
+ */
+
+void bench_samples_add(bench_samples_t *samples, double seconds,
+		       size_t items)
+{
+	samples->seconds += seconds;
+	samples->items += items;
+	if (samples->size < samples->capacity)
+		samples->ns[samples->size++] = seconds * 1e9 /
+			(items ? items : 1);
+}
@@ -0,0 +1,67 @@
+#include "bench.h"
+
+/**
+ * bench_grid - generates a square 2D grid, each vertex linked to its right
+ * and lower neighbours, in both directions
+ * @scale: the grid has 2^(@scale / 2) vertices per side
+ * Return: the edge list, or NULL on failure
+ */
+
+bench_edges_t *bench_grid(size_t scale)
+{
+	size_t side = (size_t)1 << (scale / 2), v, e = 0;
+	bench_edges_t *edges;
+
+	edges = bench_edges_create(side * side, 4 * side * (side - 1));
+	for (v = 0; edges && v < side * side; v++)
+	{
+		if (v % side + 1 < side)
+		{
+			edges->src[e] = v, edges->dest[e++] = v + 1;
+			edges->src[e] = v + 1, edges->dest[e++] = v;
+		}
+		if (v + side < side * side)
+		{
+			edges->src[e] = v, edges->dest[e++] = v + side;
+			edges->src[e] = v + side, edges->dest[e++] = v;
+		}
+	}
+	return (edges);
+}
+
+/**
+ * bench_chain - generates a long directed path, the worst case for the
+ * depth of a depth-first search
+ * @scale: the path has 2^@scale vertices
+ * Return: the edge list, or NULL on failure
+ */
+
+bench_edges_t *bench_chain(size_t scale)
+{
+	size_t n = (size_t)1 << scale, v;
+	bench_edges_t *edges = bench_edges_create(n, n - 1);
+
+	for (v = 0; edges && v + 1 < n; v++)
+		edges->src[v] = v, edges->dest[v] = v + 1;
+	return (edges);
+}
+
+/**
+ * bench_star - generates a star, vertex 0 being linked to and from every
+ * other vertex, the worst case for the width of a breadth-first search
+ * @scale: the star has 2^@scale vertices
+ * Return: the edge list, or NULL on failure
+ */
+
+bench_edges_t *bench_star(size_t scale)
+{
+	size_t n = (size_t)1 << scale, v;
+	bench_edges_t *edges = bench_edges_create(n, 2 * (n - 1));
+
+	for (v = 1; edges && v < n; v++)
+	{
+		edges->src[2 * v - 2] = 0, edges->dest[2 * v - 2] = v;
+		edges->src[2 * v - 1] = v, edges->dest[2 * v - 1] = 0;
+	}
+	return (edges);
+}
@@ -0,0 +1,75 @@
+#include "graphs.h"
+
+/**
+ * breadth_first_traverse_csr_from - traverses a compressed-sparse-row
+ * snapshot using breadth-first search, starting from a given vertex
+ * Every vertex is queued at most once, so the queue is a plain array
+ * of nb_vertices indices and a level ends where the previous one did
+ * @csr: the snapshot to traverse
+ * @source: the index of the vertex to start from
+ * @action: a function to perform an action on each vertex along with
+ * its breadth
+ * Return: the max breadth, or 0 on failure
+ */
+
+size_t breadth_first_traverse_csr_from(const graph_csr_t *csr, size_t source,
+				       void (*action)(const graph_csr_t *csr,
+						      size_t v, size_t breadth))
+{
+	unsigned char *visited;
+	size_t *queue, head = 0, tail = 1, level_end = 1, breadth = 0, v, e;
+
+	if (!csr || !action || source >= csr->nb_vertices)
+		return (0);
+
+	visited = calloc(csr->nb_vertices, sizeof(*visited));
+	queue = malloc(csr->nb_vertices * sizeof(*queue));
+	if (!visited || !queue)
+	{
+		free(visited), free(queue);
+		return (0);
+	}
+
+	STATS_BEGIN(GRAPH_PHASE_TRAVERSE);
+	STATS_ADD(bytes_allocated, csr->nb_vertices * (1 + sizeof(*queue)));
+	queue[0] = source, visited[source] = 1;
+	while (head < tail)
+	{
+		if (head == level_end)
+			breadth++, level_end = tail;
+
+		v = queue[head++];
+		action(csr, v, breadth);
+		STATS_ADD(vertices_visited, 1);
+		STATS_ADD(edges_scanned, csr->offsets[v + 1] - csr->offsets[v]);
+		for (e = csr->offsets[v]; e < csr->offsets[v + 1]; e++)
+		{
+			if (!visited[csr->dests[e]])
+			{
+				visited[csr->dests[e]] = 1;
+				queue[tail++] = csr->dests[e];
+			}
+		}
+		STATS_PEAK(tail - head);
+	}
+	STATS_END(GRAPH_PHASE_TRAVERSE);
+
+	free(visited), free(queue);
+	return (breadth);
+}
+
+/**
+ * breadth_first_traverse_csr - traverses a compressed-sparse-row snapshot
+ * using breadth-first search, starting from the vertex of index 0
+ * @csr: the snapshot to traverse
+ * @action: a function to perform an action on each vertex along with
+ * its breadth
+ * Return: the max breadth, or 0 on failure
+ */
+
+size_t breadth_first_traverse_csr(const graph_csr_t *csr,
+				  void (*action)(const graph_csr_t *csr,
+						 size_t v, size_t breadth))
+{
+	return (breadth_first_traverse_csr_from(csr, 0, action));
+}
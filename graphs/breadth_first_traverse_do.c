@@ -0,0 +1,190 @@
+#include "graphs.h"
+
+/**
+ * discover - marks a vertex as visited and adds it to the next level
+ * @csr: the snapshot being traversed
+ * @visited: bitmap of the vertices already visited
+ * @next: the level being built
+ * @v: the index of the discovered vertex
+ * Return: the out-degree of @v
+ */
+
+static size_t discover(const graph_csr_t *csr, unsigned long *visited,
+		       bfs_frontier_t *next, size_t v)
+{
+	BITMAP_SET(visited, v);
+	BITMAP_SET(next->bits, v);
+	next->list[next->size++] = v;
+
+	return (csr->offsets[v + 1] - csr->offsets[v]);
+}
+
+/**
+ * top_down_step - builds the next level by scanning the out-edges of
+ * every vertex of the current level
+ * @csr: the snapshot being traversed
+ * @visited: bitmap of the vertices already visited
+ * @curr: the current level
+ * @next: the level to build, empty
+ * Return: the number of out-edges of the next level
+ */
+
+static size_t top_down_step(const graph_csr_t *csr, unsigned long *visited,
+			    const bfs_frontier_t *curr, bfs_frontier_t *next)
+{
+	size_t i, e, w, edges = 0;
+
+	for (i = 0; i < curr->size; i++)
+	{
+		STATS_ADD(edges_scanned, csr->offsets[curr->list[i] + 1] -
+			  csr->offsets[curr->list[i]]);
+		for (e = csr->offsets[curr->list[i]];
+		     e < csr->offsets[curr->list[i] + 1]; e++)
+		{
+			w = csr->dests[e];
+			if (!BITMAP_TEST(visited, w))
+				edges += discover(csr, visited, next, w);
+		}
+	}
+
+	return (edges);
+}
+
+/**
+ * bottom_up_step - builds the next level by looking, for every vertex not
+ * visited yet, for an in-neighbour that belongs to the current level
+ * @csr: the snapshot being traversed, with its reverse adjacency
+ * @visited: bitmap of the vertices already visited
+ * @curr: the current level
+ * @next: the level to build, empty
+ * Return: the number of out-edges of the next level
+ */
+
+static size_t bottom_up_step(const graph_csr_t *csr, unsigned long *visited,
+			     const bfs_frontier_t *curr, bfs_frontier_t *next)
+{
+	size_t v, e, edges = 0;
+
+	for (v = 0; v < csr->nb_vertices; v++)
+	{
+		if (visited[v / WORD_BITS] == ~0UL)
+		{
+			v += WORD_BITS - 1 - v % WORD_BITS;
+			continue;
+		}
+		if (BITMAP_TEST(visited, v))
+			continue;
+		for (e = csr->in_offsets[v]; e < csr->in_offsets[v + 1]; e++)
+		{
+			STATS_ADD(edges_scanned, 1);
+			if (BITMAP_TEST(curr->bits, csr->in_srcs[e]))
+			{
+				edges += discover(csr, visited, next, v);
+				break;
+			}
+		}
+	}
+
+	return (edges);
+}
+
+/**
+ * frontiers_create - allocates the visited bitmap and the two levels of
+ * a direction-optimizing BFS in a single block, and sets up the view of the
+ * snapshot the bottom-up steps read
+ * The view is a copy of the header of the snapshot, given a reverse
+ * adjacency of its own if the snapshot has none
+ * @csr: the snapshot
+ * @view: the view to set up
+ * @levels: the two levels to set up
+ * Return: the visited bitmap, which owns the block, or NULL on failure
+ */
+
+static unsigned long *frontiers_create(const graph_csr_t *csr,
+				       graph_csr_t *view,
+				       bfs_frontier_t *levels)
+{
+	size_t n = csr->nb_vertices, words = BITMAP_WORDS(n);
+	unsigned long *visited;
+
+	*view = *csr;
+	if (!view->in_offsets && !graph_csr_add_reverse(view))
+		return (NULL);
+	visited = calloc(1, 3 * words * sizeof(unsigned long) +
+			 2 * n * sizeof(size_t));
+	if (!visited)
+	{
+		if (view->in_offsets != csr->in_offsets)
+			free(view->in_offsets), free(view->in_srcs);
+		return (NULL);
+	}
+
+	levels[0].bits = visited + words;
+	levels[1].bits = visited + 2 * words;
+	levels[0].list = (size_t *)(visited + 3 * words);
+	levels[1].list = levels[0].list + n;
+	levels[0].size = levels[1].size = 0;
+
+	return (visited);
+}
+
+/**
+ * breadth_first_traverse_do - direction-optimizing breadth-first search
+ * from the vertex of index 0 of a snapshot
+ * Levels are built top-down while they are small, and bottom-up through
+ * the reverse adjacency once the out-edges of the level outweigh the
+ * edges left to explore by DOBFS_ALPHA, until the level shrinks below
+ * nb_vertices / DOBFS_BETA vertices again
+ * The snapshot is only read, so readers may share it; if it has no reverse
+ * adjacency, one is built and freed by this call
+ * @csr: the snapshot to traverse
+ * @action: a function to perform an action on each vertex along with
+ * its breadth, called level by level
+ * Return: the max breadth, or 0 on failure
+ */
+
+size_t breadth_first_traverse_do(const graph_csr_t *csr,
+				 void (*action)(const graph_csr_t *csr,
+						size_t v, size_t breadth))
+{
+	bfs_frontier_t levels[2], *curr = levels, *next = levels + 1, *tmp;
+	size_t breadth = 0, i, edges_left, edges, words;
+	unsigned long *visited;
+	graph_csr_t view;
+	int bottom_up = 0;
+
+	if (!csr || !action || csr->nb_vertices == 0)
+		return (0);
+	visited = frontiers_create(csr, &view, levels);
+	if (!visited)
+		return (0);
+	STATS_BEGIN(GRAPH_PHASE_TRAVERSE);
+	words = BITMAP_WORDS(csr->nb_vertices);
+	STATS_ADD(bytes_allocated, 3 * words * sizeof(unsigned long) +
+		  2 * csr->nb_vertices * sizeof(size_t));
+	edges = discover(csr, visited, curr, 0);
+	edges_left = csr->nb_edges - edges;
+	for (action(csr, 0, 0); curr->size > 0; breadth++)
+	{
+		if (!bottom_up && edges > edges_left / DOBFS_ALPHA)
+			bottom_up = 1;
+		else if (bottom_up &&
+			 curr->size < csr->nb_vertices / DOBFS_BETA)
+			bottom_up = 0;
+		next->size = 0;
+		memset(next->bits, 0, words * sizeof(unsigned long));
+		edges = bottom_up ? bottom_up_step(&view, visited, curr, next) :
+			top_down_step(csr, visited, curr, next);
+		edges_left -= edges;
+		STATS_ADD(vertices_visited, next->size), STATS_PEAK(next->size);
+		for (i = 0; i < next->size; i++)
+			action(csr, next->list[i], breadth + 1);
+		tmp = curr, curr = next, next = tmp;
+	}
+	STATS_ADD(vertices_visited, 1);
+	STATS_END(GRAPH_PHASE_TRAVERSE);
+	if (view.in_offsets != csr->in_offsets)
+		free(view.in_offsets), free(view.in_srcs);
+	free(visited);
+	return (breadth - 1);
+}
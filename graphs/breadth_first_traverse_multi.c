@@ -0,0 +1,136 @@
+#include "graphs.h"
+
+/**
+ * msbfs_visit - spreads the visit masks of the current level along the
+ * out-edges of every vertex, so one edge scan serves every source
+ * @csr: the snapshot being traversed
+ * @visit: visit mask of each vertex for the current level
+ * @next: visit mask of each vertex for the next level, cleared
+ */
+
+static void msbfs_visit(const graph_csr_t *csr, const unsigned long *visit,
+			unsigned long *next)
+{
+	size_t v, e;
+
+	for (v = 0; v < csr->nb_vertices; v++)
+	{
+		if (!visit[v])
+			continue;
+		STATS_ADD(vertices_visited, 1);
+		STATS_ADD(edges_scanned, csr->offsets[v + 1] - csr->offsets[v]);
+		for (e = csr->offsets[v]; e < csr->offsets[v + 1]; e++)
+			next[csr->dests[e]] |= visit[v];
+	}
+}
+
+/**
+ * msbfs_settle - keeps in the next level only the sources that had not
+ * reached each vertex yet, and records the depth for those sources
+ * @csr: the snapshot being traversed
+ * @seen: mask of the sources that already reached each vertex
+ * @next: visit mask of each vertex for the next level
+ * @depths: depth rows of the sources of the batch
+ * @depth: the depth of the next level
+ * Return: 1 if any source reached a new vertex, 0 otherwise
+ */
+
+static int msbfs_settle(const graph_csr_t *csr, unsigned long *seen,
+			unsigned long *next, size_t *depths, size_t depth)
+{
+	size_t v, i;
+	unsigned long fresh;
+	int active = 0;
+
+	for (v = 0; v < csr->nb_vertices; v++)
+	{
+		fresh = next[v] & ~seen[v];
+		next[v] = fresh;
+		if (!fresh)
+			continue;
+		seen[v] |= fresh, active = 1;
+		for (i = 0; fresh; i++, fresh >>= 1)
+			if (fresh & 1)
+				depths[i * csr->nb_vertices + v] = depth;
+	}
+
+	return (active);
+}
+
+/**
+ * msbfs_batch - runs up to WORD_BITS breadth-first searches together,
+ * source i of the batch owning bit i of every mask
+ * @csr: the snapshot to traverse
+ * @sources: indices of the sources of the batch
+ * @nb_sources: number of sources in the batch, at most WORD_BITS
+ * @masks: scratch array of 3 * nb_vertices masks
+ * @depths: depth rows of the sources of the batch
+ */
+
+static void msbfs_batch(const graph_csr_t *csr, const size_t *sources,
+			size_t nb_sources, unsigned long *masks, size_t *depths)
+{
+	unsigned long *seen = masks, *visit = masks + csr->nb_vertices;
+	unsigned long *next = visit + csr->nb_vertices, *tmp;
+	size_t i, depth = 0;
+
+	memset(masks, 0, 3 * csr->nb_vertices * sizeof(unsigned long));
+	for (i = 0; i < nb_sources; i++)
+	{
+		seen[sources[i]] |= 1UL << i;
+		visit[sources[i]] |= 1UL << i;
+		depths[i * csr->nb_vertices + sources[i]] = 0;
+	}
+
+	do {
+		msbfs_visit(csr, visit, next);
+		memset(visit, 0, csr->nb_vertices * sizeof(unsigned long));
+		tmp = visit, visit = next, next = tmp;
+	} while (msbfs_settle(csr, seen, visit, depths, ++depth));
+}
+
+/**
+ * breadth_first_traverse_multi - breadth-first searches from many sources
+ * of a snapshot at once, WORD_BITS sources sharing each adjacency scan
+ * @csr: the snapshot to traverse
+ * @sources: indices of the source vertices
+ * @nb_sources: number of sources
+ * Return: an array of nb_sources rows of nb_vertices depths, row i giving
+ * the breadth of each vertex from sources[i] or PBFS_UNVISITED if it is
+ * not reached, to be freed by the caller; NULL on failure
+ */
+
+size_t *breadth_first_traverse_multi(const graph_csr_t *csr,
+				     const size_t *sources, size_t nb_sources)
+{
+	size_t *depths, i, n;
+	unsigned long *masks;
+
+	if (!csr || !sources || nb_sources == 0 || csr->nb_vertices == 0)
+		return (NULL);
+	for (i = 0; i < nb_sources; i++)
+		if (sources[i] >= csr->nb_vertices)
+			return (NULL);
+
+	depths = malloc(nb_sources * csr->nb_vertices * sizeof(size_t));
+	masks = malloc(3 * csr->nb_vertices * sizeof(unsigned long));
+	if (!depths || !masks)
+		return (free(depths), free(masks), NULL);
+
+	STATS_BEGIN(GRAPH_PHASE_TRAVERSE);
+	STATS_ADD(bytes_allocated, (nb_sources * sizeof(size_t) +
+				    3 * sizeof(unsigned long)) *
+		  csr->nb_vertices);
+	for (i = 0; i < nb_sources * csr->nb_vertices; i++)
+		depths[i] = PBFS_UNVISITED;
+	for (i = 0; i < nb_sources; i += WORD_BITS)
+	{
+		n = nb_sources - i < WORD_BITS ? nb_sources - i : WORD_BITS;
+		msbfs_batch(csr, sources + i, n, masks,
+			    depths + i * csr->nb_vertices);
+	}
+
+	STATS_END(GRAPH_PHASE_TRAVERSE);
+	free(masks);
+	return (depths);
+}
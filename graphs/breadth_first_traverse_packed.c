@@ -0,0 +1,99 @@
+#include "graphs.h"
+
+/**
+ * packed_expand - decodes the neighbours of a vertex of a delta-compressed
+ * snapshot straight from its bytes, queueing those not visited yet
+ * Each control byte is read once and shifted for the next three numbers
+ * @packed: the snapshot
+ * @v: the index of the vertex
+ * @visited: an array flagging the vertices already visited
+ * @queue: the queue of the traversal
+ * @tail: the position past the last vertex of @queue
+ * Return: the new position past the last vertex of @queue
+ */
+
+static size_t packed_expand(const graph_packed_t *packed, size_t v,
+			    unsigned char *visited, size_t *queue, size_t tail)
+{
+	const unsigned char *p = packed->bytes + packed->offsets[v];
+	const unsigned char *ctrl;
+	size_t n, k, code, w, c;
+
+	if (packed->offsets[v] == packed->offsets[v + 1])
+		return (tail);
+	VARINT_GET(p, n);
+	STATS_ADD(edges_scanned, n);
+	ctrl = p;
+	p += (n + 3) / 4;
+	c = ctrl[0];
+	code = c & 3;
+	w = PACKED_FIRST(v, PACKED_LOAD(p, code));
+	p += code + 1;
+	if (!visited[w])
+		visited[w] = 1, queue[tail++] = w;
+	for (k = 1; k < n; k++)
+	{
+		c = k & 3 ? c >> 2 : ctrl[k >> 2];
+		code = c & 3;
+		w += PACKED_LOAD(p, code);
+		p += code + 1;
+		if (!visited[w])
+			visited[w] = 1, queue[tail++] = w;
+	}
+
+	return (tail);
+}
+
+/**
+ * breadth_first_traverse_packed - traverses a delta-compressed snapshot
+ * using breadth-first search, starting from the vertex of index 0
+ * Works as breadth_first_traverse_csr, the neighbours of each vertex
+ * being decoded and visited by increasing index in a single pass; the
+ * bytes of the vertex PACKED_PREFETCH places ahead in the queue are
+ * prefetched, as reading n waits on offsets[v] and everything else on n
+ * @packed: the snapshot to traverse
+ * @action: a function to perform an action on each vertex along with
+ * its breadth
+ * Return: the max breadth, or 0 on failure
+ */
+
+size_t breadth_first_traverse_packed(const graph_packed_t *packed,
+				     void (*action)(const graph_packed_t *p,
+						    size_t v, size_t breadth))
+{
+	unsigned char *visited;
+	size_t *queue, head = 0, tail = 1, level_end = 1, breadth = 0, v;
+
+	if (!packed || !action || packed->nb_vertices == 0)
+		return (0);
+
+	visited = calloc(packed->nb_vertices, sizeof(*visited));
+	queue = malloc(packed->nb_vertices * sizeof(*queue));
+	if (!visited || !queue)
+	{
+		free(visited), free(queue);
+		return (0);
+	}
+
+	STATS_BEGIN(GRAPH_PHASE_TRAVERSE);
+	STATS_ADD(bytes_allocated, packed->nb_vertices * (1 + sizeof(*queue)));
+	queue[0] = 0, visited[0] = 1;
+	while (head < tail)
+	{
+		if (head == level_end)
+			breadth++, level_end = tail;
+
+		v = queue[head++];
+		if (head + PACKED_PREFETCH < tail)
+			__builtin_prefetch(packed->bytes + packed->offsets[
+					   queue[head + PACKED_PREFETCH]]);
+		action(packed, v, breadth);
+		STATS_ADD(vertices_visited, 1);
+		tail = packed_expand(packed, v, visited, queue, tail);
+		STATS_PEAK(tail - head);
+	}
+	STATS_END(GRAPH_PHASE_TRAVERSE);
+
+	free(visited), free(queue);
+	return (breadth);
+}
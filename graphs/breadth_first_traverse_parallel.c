@@ -0,0 +1,181 @@
+#include "graphs.h"
+
+/**
+ * pbfs_flush - moves the vertices discovered by a worker to the next level
+ * Room is reserved with a single atomic add, so the copy is not contended
+ * @worker: the worker
+ */
+
+static void pbfs_flush(pbfs_worker_t *worker)
+{
+	pbfs_shared_t *shared = worker->shared;
+	size_t pos;
+
+	if (worker->local_size == 0)
+		return;
+
+	pos = __sync_fetch_and_add(&shared->next_size, worker->local_size);
+	memcpy(shared->next + pos, worker->local,
+	       worker->local_size * sizeof(size_t));
+	worker->local_size = 0;
+}
+
+/**
+ * pbfs_expand - claims the unvisited out-neighbours of a vertex
+ * A neighbour belongs to the worker whose compare-and-swap moves its level
+ * from PBFS_UNVISITED to the level being built
+ * @worker: the worker
+ * @u: the index of the vertex to expand
+ */
+
+static void pbfs_expand(pbfs_worker_t *worker, size_t u)
+{
+	pbfs_shared_t *shared = worker->shared;
+	const graph_csr_t *csr = shared->csr;
+	size_t e, w;
+
+	STATS_ADD(edges_scanned, csr->offsets[u + 1] - csr->offsets[u]);
+	for (e = csr->offsets[u]; e < csr->offsets[u + 1]; e++)
+	{
+		w = csr->dests[e];
+		if (__atomic_load_n(shared->levels + w, __ATOMIC_RELAXED) !=
+		    PBFS_UNVISITED ||
+		    !__sync_bool_compare_and_swap(shared->levels + w,
+						  PBFS_UNVISITED,
+						  shared->depth + 1))
+			continue;
+
+		shared->parents[w] = u;
+		worker->local[worker->local_size++] = w;
+		if (worker->local_size == PBFS_LOCAL_SIZE)
+			pbfs_flush(worker);
+	}
+}
+
+/**
+ * pbfs_run - body of a worker: expands chunks of the current level until
+ * it is exhausted, then meets the other workers to move to the next level
+ * @arg: a pointer to the pbfs_worker_t of the worker
+ * Return: NULL
+ */
+
+static void *pbfs_run(void *arg)
+{
+	pbfs_worker_t *worker = arg;
+	pbfs_shared_t *shared = worker->shared;
+	size_t start, i, *tmp;
+
+	pthread_mutex_lock(&shared->start);
+	pthread_mutex_unlock(&shared->start);
+	while (shared->frontier_size > 0)
+	{
+		while ((start = __sync_fetch_and_add(&shared->cursor,
+						     PBFS_CHUNK)) <
+		       shared->frontier_size)
+		{
+			for (i = start; i < start + PBFS_CHUNK &&
+				     i < shared->frontier_size; i++)
+				pbfs_expand(worker, shared->frontier[i]);
+		}
+		pbfs_flush(worker);
+		pthread_barrier_wait(&shared->barrier);
+		if (worker->id == 0)
+		{
+			tmp = shared->frontier, shared->frontier = shared->next;
+			shared->next = tmp;
+			shared->frontier_size = shared->next_size;
+			shared->next_size = shared->cursor = 0;
+			shared->depth += shared->frontier_size > 0;
+			STATS_ADD(vertices_visited, shared->frontier_size);
+			STATS_PEAK(shared->frontier_size);
+		}
+		pthread_barrier_wait(&shared->barrier);
+	}
+	return (NULL);
+}
+
+/**
+ * pbfs_spawn - starts the workers of a parallel BFS, the calling thread
+ * being the worker 0
+ * The barrier is only set up once the number of threads actually started
+ * is known, which the workers wait for on the start mutex
+ * @shared: the state shared by the workers
+ * @workers: the workers, with their local buffers allocated
+ * @nb_threads: the number of workers wanted
+ * Return: the number of workers started, the calling thread included
+ */
+
+static size_t pbfs_spawn(pbfs_shared_t *shared, pbfs_worker_t *workers,
+			 size_t nb_threads)
+{
+	size_t n = 1;
+
+	pthread_mutex_lock(&shared->start);
+	while (n < nb_threads &&
+	       pthread_create(&workers[n].thread, NULL, pbfs_run,
+			      workers + n) == 0)
+		n++;
+	pthread_barrier_init(&shared->barrier, NULL, n);
+	pthread_mutex_unlock(&shared->start);
+
+	pbfs_run(workers);
+	for (nb_threads = 1; nb_threads < n; nb_threads++)
+		pthread_join(workers[nb_threads].thread, NULL);
+	pthread_barrier_destroy(&shared->barrier);
+
+	return (n);
+}
+
+/**
+ * breadth_first_traverse_parallel - level-synchronous breadth-first search
+ * from the vertex of index 0 of a snapshot, each level being split across
+ * @nb_threads threads
+ * @csr: the snapshot to traverse
+ * @nb_threads: the number of threads to use
+ * @levels: array of nb_vertices entries, filled with the breadth of each
+ * vertex, or PBFS_UNVISITED for the vertices that are not reached
+ * @parents: array of nb_vertices entries, filled with the index of the
+ * vertex each reached vertex was discovered from (the root is its own)
+ * Return: the max breadth, or 0 on failure
+ */
+
+size_t breadth_first_traverse_parallel(const graph_csr_t *csr,
+				       size_t nb_threads, size_t *levels,
+				       size_t *parents)
+{
+	pbfs_shared_t shared;
+	pbfs_worker_t *workers;
+	size_t i, *queues;
+
+	if (!csr || !levels || !parents || csr->nb_vertices == 0)
+		return (0);
+	nb_threads = nb_threads ? nb_threads : 1;
+	queues = malloc((2 * csr->nb_vertices +
+			 nb_threads * PBFS_LOCAL_SIZE) * sizeof(size_t));
+	workers = malloc(nb_threads * sizeof(pbfs_worker_t));
+	if (!queues || !workers)
+		return (free(queues), free(workers), 0);
+	memset(&shared, 0, sizeof(shared));
+	shared.csr = csr, shared.levels = levels, shared.parents = parents;
+	shared.frontier = queues, shared.next = queues + csr->nb_vertices;
+	for (i = 0; i < csr->nb_vertices; i++)
+		levels[i] = PBFS_UNVISITED;
+	levels[0] = 0, parents[0] = 0, shared.frontier[0] = 0;
+	shared.frontier_size = 1;
+	for (i = 0; i < nb_threads; i++)
+	{
+		workers[i].shared = &shared, workers[i].id = i;
+		workers[i].local = queues + 2 * csr->nb_vertices +
+			i * PBFS_LOCAL_SIZE;
+		workers[i].local_size = 0;
+	}
+	STATS_BEGIN(GRAPH_PHASE_TRAVERSE), STATS_ADD(vertices_visited, 1);
+	STATS_ADD(bytes_allocated, (2 * csr->nb_vertices + nb_threads *
+				    PBFS_LOCAL_SIZE) * sizeof(size_t));
+	pthread_mutex_init(&shared.start, NULL);
+	pbfs_spawn(&shared, workers, nb_threads);
+	STATS_END(GRAPH_PHASE_TRAVERSE);
+	pthread_mutex_destroy(&shared.start);
+	free(queues), free(workers);
+	return (shared.depth);
+}
@@ -0,0 +1,97 @@
+#include "graphs.h"
+
+/**
+ * csr_dfs_from - runs an iterative depth-first search from a single root
+ * of a compressed-sparse-row snapshot
+ * @csr: the snapshot to traverse
+ * @root: the index of the root vertex, not visited yet
+ * @visited: an array flagging the vertices already visited
+ * @stack: a scratch array of nb_vertices vertex indices
+ * @cursor: a scratch array of nb_vertices positions in csr->dests
+ * @action: a function called on each vertex along with its depth
+ * Return: the maximum depth reached from @root
+ */
+
+static size_t csr_dfs_from(const graph_csr_t *csr, size_t root,
+			   unsigned char *visited, size_t *stack,
+			   size_t *cursor,
+			   void (*action)(const graph_csr_t *csr, size_t v,
+					  size_t depth))
+{
+	size_t top = 0, max_depth = 0, v, w;
+
+	visited[root] = 1;
+	action(csr, root, 0);
+	STATS_ADD(vertices_visited, 1), STATS_PEAK(1);
+	stack[0] = root;
+	cursor[0] = csr->offsets[root];
+
+	while (1)
+	{
+		v = stack[top];
+		if (cursor[top] == csr->offsets[v + 1])
+		{
+			if (top-- == 0)
+				break;
+			continue;
+		}
+		w = csr->dests[cursor[top]++];
+		STATS_ADD(edges_scanned, 1);
+		if (visited[w])
+			continue;
+
+		visited[w] = 1;
+		action(csr, w, ++top);
+		STATS_ADD(vertices_visited, 1), STATS_PEAK(top + 1);
+		if (top > max_depth)
+			max_depth = top;
+		stack[top] = w;
+		cursor[top] = csr->offsets[w];
+	}
+
+	return (max_depth);
+}
+
+/**
+ * depth_first_traverse_csr - traverses a compressed-sparse-row snapshot
+ * using depth-first search, starting a new search from every vertex that
+ * the previous ones did not reach
+ * @csr: the snapshot to traverse
+ * @action: a function to perform an action on each vertex along with its depth
+ * Return: the maximum depth reached during traversal
+ */
+
+size_t depth_first_traverse_csr(const graph_csr_t *csr,
+				void (*action)(const graph_csr_t *csr, size_t v,
+					       size_t depth))
+{
+	unsigned char *visited;
+	size_t *stack, *cursor, v, depth, max_depth = 0;
+
+	if (!csr || !action || csr->nb_vertices == 0)
+		return (0);
+
+	visited = calloc(csr->nb_vertices, sizeof(*visited));
+	stack = malloc(csr->nb_vertices * sizeof(*stack));
+	cursor = malloc(csr->nb_vertices * sizeof(*cursor));
+
+	if (visited && stack && cursor)
+	{
+		STATS_BEGIN(GRAPH_PHASE_TRAVERSE);
+		STATS_ADD(bytes_allocated, csr->nb_vertices *
+			  (1 + sizeof(*stack) + sizeof(*cursor)));
+		for (v = 0; v < csr->nb_vertices; v++)
+		{
+			if (visited[v])
+				continue;
+			depth = csr_dfs_from(csr, v, visited, stack, cursor,
+					     action);
+			if (depth > max_depth)
+				max_depth = depth;
+		}
+		STATS_END(GRAPH_PHASE_TRAVERSE);
+	}
+
+	free(visited), free(stack), free(cursor);
+	return (max_depth);
+}
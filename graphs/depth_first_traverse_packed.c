@@ -0,0 +1,135 @@
+#include "graphs.h"
+
+/**
+ * packed_open - points a cursor at the first neighbour of a vertex of a
+ * delta-compressed snapshot
+ * @packed: the snapshot
+ * @v: the index of the vertex
+ * @cursor: the cursor
+ */
+
+static void packed_open(const graph_packed_t *packed, size_t v,
+			packed_cursor_t *cursor)
+{
+	const unsigned char *p = packed->bytes + packed->offsets[v];
+
+	cursor->index = 0, cursor->count = 0, cursor->last = v;
+	if (packed->offsets[v] == packed->offsets[v + 1])
+		return;
+	VARINT_GET(p, cursor->count);
+	cursor->ctrl = p;
+	cursor->data = p + (cursor->count + 3) / 4;
+}
+
+/**
+ * packed_next - decodes the next neighbour of a vertex being explored
+ * @cursor: the cursor, not at the end of the neighbours
+ * Return: the index of the neighbour
+ */
+
+static size_t packed_next(packed_cursor_t *cursor)
+{
+	size_t code = PACKED_CODE(cursor->ctrl, cursor->index);
+	size_t x = PACKED_LOAD(cursor->data, code);
+
+	cursor->data += code + 1;
+	if (cursor->index++ == 0)
+		cursor->last = PACKED_FIRST(cursor->last, x);
+	else
+		cursor->last += x;
+
+	return (cursor->last);
+}
+
+/**
+ * packed_dfs_from - runs an iterative depth-first search from a single
+ * root of a delta-compressed snapshot
+ * @packed: the snapshot to traverse
+ * @root: the index of the root vertex, not visited yet
+ * @visited: an array flagging the vertices already visited
+ * @stack: a scratch array of nb_vertices cursors
+ * @action: a function called on each vertex along with its depth
+ * Return: the maximum depth reached from @root
+ */
+
+static size_t packed_dfs_from(const graph_packed_t *packed, size_t root,
+			      unsigned char *visited, packed_cursor_t *stack,
+			      void (*action)(const graph_packed_t *packed,
+					     size_t v, size_t depth))
+{
+	size_t top = 0, max_depth = 0, w;
+
+	visited[root] = 1;
+	action(packed, root, 0);
+	STATS_ADD(vertices_visited, 1), STATS_PEAK(1);
+	packed_open(packed, root, stack);
+
+	while (1)
+	{
+		if (stack[top].index == stack[top].count)
+		{
+			if (top-- == 0)
+				break;
+			continue;
+		}
+		w = packed_next(stack + top);
+		STATS_ADD(edges_scanned, 1);
+		if (visited[w])
+			continue;
+
+		visited[w] = 1;
+		action(packed, w, ++top);
+		STATS_ADD(vertices_visited, 1), STATS_PEAK(top + 1);
+		if (top > max_depth)
+			max_depth = top;
+		packed_open(packed, w, stack + top);
+	}
+
+	return (max_depth);
+}
+
+/**
+ * depth_first_traverse_packed - traverses a delta-compressed snapshot
+ * using depth-first search, starting a new search from every vertex that
+ * the previous ones did not reach
+ * Works as depth_first_traverse_csr, the neighbours of each vertex being
+ * decoded one at a time, by increasing index
+ * @packed: the snapshot to traverse
+ * @action: a function to perform an action on each vertex along with its depth
+ * Return: the maximum depth reached during traversal
+ */
+
+size_t depth_first_traverse_packed(const graph_packed_t *packed,
+				   void (*action)(const graph_packed_t *packed,
+						  size_t v, size_t depth))
+{
+	unsigned char *visited;
+	packed_cursor_t *stack;
+	size_t v, depth, max_depth = 0;
+
+	if (!packed || !action || packed->nb_vertices == 0)
+		return (0);
+
+	visited = calloc(packed->nb_vertices, sizeof(*visited));
+	stack = malloc(packed->nb_vertices * sizeof(*stack));
+
+	if (visited && stack)
+	{
+		STATS_BEGIN(GRAPH_PHASE_TRAVERSE);
+		STATS_ADD(bytes_allocated, packed->nb_vertices *
+			  (1 + sizeof(*stack)));
+		for (v = 0; v < packed->nb_vertices; v++)
+		{
+			if (visited[v])
+				continue;
+			depth = packed_dfs_from(packed, v, visited, stack,
+						action);
+			if (depth > max_depth)
+				max_depth = depth;
+		}
+		STATS_END(GRAPH_PHASE_TRAVERSE);
+	}
+
+	free(visited), free(stack);
+	return (max_depth);
+}
@@ -0,0 +1,137 @@
+#include "graphs.h"
+
+/**
+ * graph_create_arena - allocates a graph whose vertices and edges are
+ * bump-allocated from large slabs, so that building the graph is
+ * mostly pointer arithmetic and graph_delete only frees the slabs
+ *
+ * Return: If memory allocation fails, return NULL.
+ * Otherwise, return a pointer to the allocated structure.
+ */
+
+graph_t *graph_create_arena(void)
+{
+	graph_t *graph = graph_create();
+
+	if (graph == NULL)
+		return (NULL);
+
+	graph->flags |= GRAPH_ARENA;
+
+	return (graph);
+}
+
+/**
+ * graph_alloc - allocates memory for a vertex or an edge
+ * In arena mode the memory is carved from the current slab, and a new slab
+ * twice as large as the previous one is started when it is full
+ * @graph: the graph that will own the memory
+ * @size: the number of bytes to allocate
+ * Return: a pointer to the memory, or NULL on failure
+ */
+
+void *graph_alloc(graph_t *graph, size_t size)
+{
+	graph_slab_t *slab = graph->slabs;
+	size_t slab_size;
+
+	STATS_ADD(bytes_allocated, !(graph->flags & GRAPH_ARENA) ? size : 0);
+	if (!(graph->flags & GRAPH_ARENA))
+		return (malloc(size));
+
+	size = (size + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+
+	if (!slab || slab->size - slab->used < size)
+	{
+		slab_size = slab ? slab->size * 2 : GRAPH_SLAB_MIN_SIZE;
+		if (slab_size > GRAPH_SLAB_MAX_SIZE)
+			slab_size = GRAPH_SLAB_MAX_SIZE;
+		if (slab_size < size)
+			slab_size = size;
+
+		slab = malloc(sizeof(graph_slab_t) + slab_size);
+		if (!slab)
+			return (NULL);
+		STATS_ADD(bytes_allocated, sizeof(graph_slab_t) + slab_size);
+
+		slab->next = graph->slabs;
+		slab->size = slab_size;
+		slab->used = 0;
+		graph->slabs = slab;
+	}
+
+	slab->used += size;
+
+	return ((char *)(slab + 1) + slab->used - size);
+}
+
+/**
+ * graph_alloc_block - allocates memory for many vertices or edges at once
+ * In arena mode the block is carved from the slabs like any other memory;
+ * otherwise it is a slab of its own, so that what is carved from it is
+ * left alone by graph_free and the block freed with the graph
+ * @graph: the graph that will own the memory
+ * @size: the number of bytes to allocate
+ * Return: a pointer to the memory, or NULL on failure
+ */
+
+void *graph_alloc_block(graph_t *graph, size_t size)
+{
+	graph_slab_t *slab;
+
+	if (graph->flags & GRAPH_ARENA)
+		return (graph_alloc(graph, size));
+
+	slab = malloc(sizeof(graph_slab_t) + size);
+	if (!slab)
+		return (NULL);
+	STATS_ADD(bytes_allocated, sizeof(graph_slab_t) + size);
+
+	slab->next = graph->slabs;
+	slab->size = slab->used = size;
+	graph->slabs = slab;
+
+	return (slab + 1);
+}
+
+/**
+ * graph_free - releases memory obtained from graph_alloc
+ * In arena mode the memory is only reclaimed when the graph is deleted,
+ * and so is the memory carved from a block of graph_alloc_block otherwise
+ * @graph: the graph owning the memory
+ * @ptr: the memory to release
+ */
+
+void graph_free(graph_t *graph, void *ptr)
+{
+	graph_slab_t *slab;
+
+	if (graph->flags & GRAPH_ARENA)
+		return;
+
+	for (slab = graph->slabs; slab; slab = slab->next)
+		if ((char *)ptr >= (char *)(slab + 1) &&
+		    (char *)ptr < (char *)(slab + 1) + slab->size)
+			return;
+	free(ptr);
+}
+
+/**
+ * graph_arena_delete - frees every slab of a graph arena, or every block
+ * of graph_alloc_block of a graph that is not one
+ * @graph: the graph owning the slabs
+ */
+
+void graph_arena_delete(graph_t *graph)
+{
+	graph_slab_t *slab = graph->slabs, *next;
+
+	while (slab)
+	{
+		next = slab->next;
+		free(slab);
+		slab = next;
+	}
+
+	graph->slabs = NULL;
+}
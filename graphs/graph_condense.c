@@ -0,0 +1,100 @@
+#include "graphs.h"
+
+/**
+ * condense_vertices - adds one vertex per component to the condensation,
+ * named after the member of lowest index, so that the index of each new
+ * vertex is its component number
+ * @dag: the condensation being built
+ * @graph: the original graph
+ * @comp: the component of each vertex index of @graph
+ * @nb_components: the number of components
+ * Return: an array of the new vertices by component, NULL on failure
+ */
+
+static vertex_t **condense_vertices(graph_t *dag, const graph_t *graph,
+				    const size_t *comp, size_t nb_components)
+{
+	vertex_t **reps = calloc(nb_components, sizeof(*reps));
+	vertex_t *vertex;
+	size_t c;
+
+	if (!reps)
+		return (NULL);
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+		if (!reps[comp[vertex->index]])
+			reps[comp[vertex->index]] = vertex;
+	for (c = 0; c < nb_components; c++)
+	{
+		reps[c] = graph_add_vertex(dag, reps[c]->content);
+		if (!reps[c])
+		{
+			free(reps);
+			return (NULL);
+		}
+	}
+	return (reps);
+}
+
+/**
+ * condense_edges - adds an edge between the components of each edge of the
+ * original graph that crosses components, once per pair of components
+ * @dag: the condensation being built, in unique-edge mode
+ * @graph: the original graph
+ * @comp: the component of each vertex index of @graph
+ * @reps: the vertices of @dag by component
+ * Return: 1 on success, 0 on failure
+ */
+
+static int condense_edges(graph_t *dag, const graph_t *graph,
+			  const size_t *comp, vertex_t **reps)
+{
+	const vertex_t *vertex;
+	const edge_t *edge;
+	vertex_t *src, *dest;
+
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+	{
+		src = reps[comp[vertex->index]];
+		for (edge = vertex->edges; edge; edge = edge->next)
+		{
+			dest = reps[comp[edge->dest->index]];
+			if (src == dest || graph_edge_set_find(dag, src, dest))
+				continue;
+			if (!graph_add_single_edge(dag, src, dest))
+				return (0);
+		}
+	}
+	return (1);
+}
+
+/**
+ * graph_condense - builds the condensation of a directed graph, the DAG
+ * with one vertex per strongly connected component and one edge for each
+ * pair of components linked by at least one edge
+ * @graph: the graph
+ * Return: the condensation, in unique-edge mode, whose vertex of index i is
+ * component i of graph_strongly_connected_components and is named after
+ * the member of lowest index; NULL on failure
+ */
+
+graph_t *graph_condense(const graph_t *graph)
+{
+	size_t *comp, nb_components;
+	vertex_t **reps = NULL;
+	graph_t *dag;
+
+	comp = graph_strongly_connected_components(graph, &nb_components);
+	if (!comp)
+		return (NULL);
+	dag = graph_create();
+	if (dag && graph_unique_edges(dag))
+		reps = condense_vertices(dag, graph, comp, nb_components);
+	if (!reps || !condense_edges(dag, graph, comp, reps))
+	{
+		graph_delete(dag);
+		dag = NULL;
+	}
+	free(comp);
+	free(reps);
+	return (dag);
+}
@@ -0,0 +1,153 @@
+#include "graphs.h"
+
+/**
+ * cc_find - finds the root of the tree of a vertex in the union-find forest,
+ * halving the path on the way with compare-and-swap so that concurrent
+ * finds and links never lose an update
+ * @parent: the union-find forest
+ * @v: the index of the vertex
+ * Return: the index of the root
+ */
+
+static size_t cc_find(size_t *parent, size_t v)
+{
+	size_t p, gp;
+
+	while ((p = __atomic_load_n(parent + v, __ATOMIC_RELAXED)) != v)
+	{
+		gp = __atomic_load_n(parent + p, __ATOMIC_RELAXED);
+		if (gp != p)
+			__sync_bool_compare_and_swap(parent + v, p, gp);
+		v = p;
+	}
+
+	return (v);
+}
+
+/**
+ * cc_union - merges the components of two vertices, the root of larger
+ * index being linked under the other one, so the final root of every
+ * component is its vertex of lowest index
+ * @parent: the union-find forest
+ * @a: the index of a vertex
+ * @b: the index of another vertex
+ */
+
+static void cc_union(size_t *parent, size_t a, size_t b)
+{
+	size_t tmp;
+
+	while (1)
+	{
+		a = cc_find(parent, a);
+		b = cc_find(parent, b);
+		if (a == b)
+			return;
+		if (a < b)
+			tmp = a, a = b, b = tmp;
+		if (__sync_bool_compare_and_swap(parent + a, a, b))
+			return;
+	}
+}
+
+/**
+ * cc_run - body of a labelling thread: takes chunks of vertices until none
+ * is left, merging the endpoints of their edges or flattening their path
+ * to the root depending on the phase
+ * @arg: a pointer to the cc_shared_t of the labelling
+ * Return: NULL
+ */
+
+static void *cc_run(void *arg)
+{
+	cc_shared_t *shared = arg;
+	const graph_csr_t *csr = shared->csr;
+	size_t start, end, v, e;
+
+	while ((start = __sync_fetch_and_add(&shared->cursor, CC_CHUNK)) <
+	       csr->nb_vertices)
+	{
+		end = start + CC_CHUNK < csr->nb_vertices ?
+			start + CC_CHUNK : csr->nb_vertices;
+		for (v = start; v < end; v++)
+		{
+			if (shared->phase == 1)
+			{
+				__atomic_store_n(shared->parent + v,
+						 cc_find(shared->parent, v),
+						 __ATOMIC_RELAXED);
+				continue;
+			}
+			for (e = csr->offsets[v]; e < csr->offsets[v + 1]; e++)
+				cc_union(shared->parent, v, csr->dests[e]);
+		}
+	}
+
+	return (NULL);
+}
+
+/**
+ * cc_phase - runs one phase of the labelling on up to @nb_threads threads,
+ * the calling thread included
+ * @shared: the state shared by the threads
+ * @phase: the phase to run
+ * @threads: array of nb_threads - 1 thread handles
+ * @nb_threads: the number of threads to use
+ */
+
+static void cc_phase(cc_shared_t *shared, int phase, pthread_t *threads,
+		     size_t nb_threads)
+{
+	size_t i, started = 0;
+
+	shared->phase = phase;
+	shared->cursor = 0;
+	for (i = 0; i + 1 < nb_threads; i++, started++)
+		if (pthread_create(threads + i, NULL, cc_run, shared) != 0)
+			break;
+
+	cc_run(shared);
+	for (i = 0; i < started; i++)
+		pthread_join(threads[i], NULL);
+}
+
+/**
+ * graph_connected_components - labels the connected components of a
+ * snapshot, edges being taken as undirected, with a lock-free union-find
+ * shared by @nb_threads threads
+ * @csr: the snapshot
+ * @nb_threads: the number of threads to use
+ * Return: an array giving, for each vertex index, the lowest vertex index
+ * of its component, to be freed by the caller; NULL on failure
+ */
+
+size_t *graph_connected_components(const graph_csr_t *csr,
+				   size_t nb_threads)
+{
+	cc_shared_t shared;
+	pthread_t *threads;
+	size_t v;
+
+	if (!csr || csr->nb_vertices == 0)
+		return (NULL);
+	nb_threads = nb_threads ? nb_threads : 1;
+
+	shared.csr = csr;
+	shared.parent = malloc(csr->nb_vertices * sizeof(size_t));
+	threads = malloc(nb_threads * sizeof(pthread_t));
+	if (!shared.parent || !threads)
+		return (free(shared.parent), free(threads), NULL);
+
+	STATS_BEGIN(GRAPH_PHASE_TRAVERSE);
+	STATS_ADD(bytes_allocated, csr->nb_vertices * sizeof(size_t));
+	for (v = 0; v < csr->nb_vertices; v++)
+		shared.parent[v] = v;
+	cc_phase(&shared, 0, threads, nb_threads);
+	cc_phase(&shared, 1, threads, nb_threads);
+	STATS_ADD(vertices_visited, csr->nb_vertices);
+	STATS_ADD(edges_scanned, csr->nb_edges);
+	STATS_END(GRAPH_PHASE_TRAVERSE);
+
+	free(threads);
+	return (shared.parent);
+}
@@ -0,0 +1,97 @@
+#ifndef GRAPH_CSR_H
+#define GRAPH_CSR_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "graph_stats.h"
+
+/*
+ * The snapshots and their binary file are shared by the graphs and the
+ * pathfinding projects, whose graph_t differ: each project freezes its own
+ * graph_t, then both save, map and read the same graph_csr_t
+ */
+
+#define GRAPH_FILE_MAGIC 0x48505247U
+#define GRAPH_FILE_VERSION 1
+#define GRAPH_FILE_WEIGHTS 1
+#define GRAPH_FILE_COORDS 2
+#define GRAPH_FILE_ALIGN(n) (((n) + 7) & ~(size_t)7)
+
+/**
+* struct graph_csr_s - Immutable compressed-sparse-row snapshot of a graph
+* The neighbours of the vertex of index i are the entries of @dests from
+* @offsets[i] included to @offsets[i + 1] excluded, in the same order as
+* the edges of the vertex in the adjacency linked list
+*
+* @nb_vertices: Number of vertices in the snapshot
+* @nb_edges: Number of edges in the snapshot
+* @offsets: Position of the first neighbour of each vertex in @dests,
+*   with a trailing entry equal to @nb_edges
+* @dests: Index of the destination vertex of each edge
+* @weights: Weight of each edge, or NULL if the graph is not weighted
+* @label_offsets: Position of the content of each vertex in @labels
+* @labels: Contents of all the vertices, each one NUL-terminated
+* @in_offsets: Same as @offsets for the reverse adjacency, or NULL if it
+*   was not built by graph_csr_add_reverse
+* @in_srcs: Index of the source vertex of each edge, grouped by destination
+* @xs: X coordinate of each vertex, or NULL if the vertices have none
+* @ys: Y coordinate of each vertex, or NULL if the vertices have none
+* @mapping: Start of the file mapping the arrays point into, or NULL if
+*   they were allocated by graph_freeze
+* @mapping_size: Size of @mapping in bytes
+*/
+typedef struct graph_csr_s
+{
+	size_t      nb_vertices;
+	size_t      nb_edges;
+	size_t      *offsets;
+	size_t      *dests;
+	int         *weights;
+	size_t      *label_offsets;
+	char        *labels;
+	size_t      *in_offsets;
+	size_t      *in_srcs;
+	int         *xs;
+	int         *ys;
+	void        *mapping;
+	size_t      mapping_size;
+} graph_csr_t;
+
+/**
+* struct graph_file_header_s - Header of a binary graph file
+* It is followed by the arrays of a graph_csr_t, in the order offsets,
+* dests, label_offsets, labels, then weights and xs/ys when the matching
+* flags are set, each one starting on a multiple of 8 bytes
+*
+* @magic: GRAPH_FILE_MAGIC, which also detects a byte order mismatch
+* @version: GRAPH_FILE_VERSION
+* @word_size: sizeof(size_t) on the machine that wrote the file
+* @flags: GRAPH_FILE_WEIGHTS and/or GRAPH_FILE_COORDS
+* @nb_vertices: Number of vertices of the graph
+* @nb_edges: Number of edges of the graph
+* @labels_size: Size of the labels blob, NUL bytes included
+*/
+typedef struct graph_file_header_s
+{
+	unsigned int magic;
+	unsigned int version;
+	unsigned int word_size;
+	unsigned int flags;
+	size_t      nb_vertices;
+	size_t      nb_edges;
+	size_t      labels_size;
+} graph_file_header_t;
+
+struct graph_s;
+
+graph_csr_t *graph_freeze(const struct graph_s *graph);
+void graph_csr_delete(graph_csr_t *csr);
+const char *graph_csr_label(const graph_csr_t *csr, size_t v);
+size_t graph_file_layout(const graph_file_header_t *header, size_t *at);
+int graph_csr_save(const graph_csr_t *csr, const char *path);
+int graph_save(const struct graph_s *graph, const char *path);
+graph_csr_t *graph_csr_map(const char *path);
+void graph_csr_unmap(graph_csr_t *csr);
+
+#endif /*GRAPH_CSR_H*/
@@ -0,0 +1,156 @@
+#include "graphs.h"
+
+/**
+ * graph_edge_set_find - looks up an edge in the edge set of a graph
+ * @graph: the graph
+ * @src: the source vertex of the edge
+ * @dest: the destination vertex of the edge
+ * Return: a pointer to the entry of the edge, or NULL if it is not in the set
+ */
+
+const edge_key_t *graph_edge_set_find(const graph_t *graph,
+				      const vertex_t *src,
+				      const vertex_t *dest)
+{
+	size_t mask, slot;
+	const edge_key_t *key;
+
+	if (graph->edge_set_size == 0)
+		return (NULL);
+
+	mask = graph->edge_set_size - 1;
+	slot = EDGE_HASH(src, dest) & mask;
+
+	for (key = graph->edge_set + slot; key->src;
+	     slot = (slot + 1) & mask, key = graph->edge_set + slot)
+	{
+		if (key->src == src && key->dest == dest)
+			return (key);
+	}
+
+	return (NULL);
+}
+
+/**
+ * graph_edge_set_reserve - makes room in the edge set for one more edge,
+ * doubling and rehashing it when it would become more than half full
+ * @graph: the graph
+ * Return: 1 on success, 0 on failure
+ */
+
+int graph_edge_set_reserve(graph_t *graph)
+{
+	edge_key_t *old = graph->edge_set;
+	size_t old_size = graph->edge_set_size, size, i;
+
+	if ((graph->nb_edge_keys + 1) * 2 <= old_size)
+		return (1);
+
+	size = old_size ? old_size * 2 : GRAPH_INDEX_MIN_SIZE;
+	graph->edge_set = calloc(size, sizeof(edge_key_t));
+	if (!graph->edge_set)
+	{
+		graph->edge_set = old;
+		return (0);
+	}
+
+	graph->edge_set_size = size;
+	graph->nb_edge_keys = 0;
+	for (i = 0; i < old_size; i++)
+		if (old[i].src)
+			graph_edge_set_insert(graph, old[i].src, old[i].dest);
+
+	free(old);
+	return (1);
+}
+
+/**
+ * graph_edge_set_insert - adds an edge to the edge set of a graph, room
+ * having been made by graph_edge_set_reserve
+ * @graph: the graph
+ * @src: the source vertex of the edge
+ * @dest: the destination vertex of the edge
+ */
+
+void graph_edge_set_insert(graph_t *graph, const vertex_t *src,
+			   const vertex_t *dest)
+{
+	size_t mask = graph->edge_set_size - 1;
+	size_t slot = EDGE_HASH(src, dest) & mask;
+
+	while (graph->edge_set[slot].src)
+	{
+		if (graph->edge_set[slot].src == src &&
+		    graph->edge_set[slot].dest == dest)
+			return;
+		slot = (slot + 1) & mask;
+	}
+
+	graph->edge_set[slot].src = src;
+	graph->edge_set[slot].dest = dest;
+	graph->nb_edge_keys++;
+}
+
+/**
+ * graph_unique_edges - switches a graph to GRAPH_UNIQUE_EDGES mode, in
+ * which every edge is kept in a hash set so that graph_has_edge is O(1)
+ * and adding an edge that already exists fails
+ * The edges already in the graph are indexed, duplicates included once
+ * @graph: the graph
+ * Return: 1 on success, 0 on failure
+ */
+
+int graph_unique_edges(graph_t *graph)
+{
+	vertex_t *vertex;
+	edge_t *edge;
+
+	if (!graph)
+		return (0);
+	if (graph->flags & GRAPH_UNIQUE_EDGES)
+		return (1);
+
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+	{
+		for (edge = vertex->edges; edge; edge = edge->next)
+		{
+			if (!graph_edge_set_reserve(graph))
+				return (0);
+			graph_edge_set_insert(graph, vertex, edge->dest);
+		}
+	}
+
+	graph->flags |= GRAPH_UNIQUE_EDGES;
+	return (1);
+}
+
+/**
+ * graph_has_edge - checks whether a graph has an edge between two vertices
+ * This is O(1) in GRAPH_UNIQUE_EDGES mode, and walks the edges of the
+ * source vertex otherwise
+ * @graph: the graph
+ * @src: the content of the source vertex
+ * @dest: the content of the destination vertex
+ * Return: 1 if the edge exists, 0 otherwise
+ */
+
+int graph_has_edge(const graph_t *graph, const char *src, const char *dest)
+{
+	vertex_t *src_vertex, *dest_vertex;
+	edge_t *edge;
+
+	src_vertex = graph_index_find(graph, src);
+	dest_vertex = graph_index_find(graph, dest);
+	if (!src_vertex || !dest_vertex)
+		return (0);
+
+	if (graph->flags & GRAPH_UNIQUE_EDGES)
+		return (graph_edge_set_find(graph, src_vertex,
+					    dest_vertex) != NULL);
+
+	for (edge = src_vertex->edges; edge; edge = edge->next)
+		if (edge->dest == dest_vertex)
+			return (1);
+
+	return (0);
+}
@@ -0,0 +1,125 @@
+#include "graph_csr.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/**
+ * map_check - checks that the arrays of a mapped graph file only point
+ * inside the mapping: the offsets must be increasing from 0 to the number
+ * of edges, every destination must be a vertex, and every label must start
+ * and end inside the labels blob
+ * This is one pass over the vertices and edges, without any allocation
+ * @csr: the snapshot, pointing into the mapping
+ * @labels_size: the size of the labels blob
+ * Return: 1 if the arrays are consistent, 0 otherwise
+ */
+
+static int map_check(const graph_csr_t *csr, size_t labels_size)
+{
+	size_t i;
+
+	if (csr->offsets[0] != 0 ||
+	    csr->offsets[csr->nb_vertices] != csr->nb_edges)
+		return (0);
+	for (i = 0; i < csr->nb_vertices; i++)
+		if (csr->offsets[i] > csr->offsets[i + 1] ||
+		    csr->label_offsets[i] >= labels_size)
+			return (0);
+	for (i = 0; i < csr->nb_edges; i++)
+		if (csr->dests[i] >= csr->nb_vertices)
+			return (0);
+
+	return (csr->nb_vertices == 0 || csr->labels[labels_size - 1] == '\0');
+}
+
+/**
+ * map_view - points the arrays of a snapshot into a mapped graph file,
+ * after checking that the file can hold them and that they are consistent
+ * @csr: the snapshot to set up
+ * @base: the start of the mapping
+ * @size: the size of the mapping
+ * Return: 1 if the file is a valid graph file for this machine, 0 otherwise
+ */
+
+static int map_view(graph_csr_t *csr, char *base, size_t size)
+{
+	graph_file_header_t *header = (graph_file_header_t *)base;
+	size_t at[7], total;
+
+	if (size < sizeof(*header) || header->magic != GRAPH_FILE_MAGIC ||
+	    header->version != GRAPH_FILE_VERSION ||
+	    header->word_size != sizeof(size_t))
+		return (0);
+	total = graph_file_layout(header, at);
+	if (total == 0 || total > size)
+		return (0);
+
+	csr->nb_vertices = header->nb_vertices;
+	csr->nb_edges = header->nb_edges;
+	csr->offsets = (size_t *)(base + at[0]);
+	csr->dests = (size_t *)(base + at[1]);
+	csr->label_offsets = (size_t *)(base + at[2]);
+	csr->labels = base + at[3];
+	csr->weights = at[4] ? (int *)(base + at[4]) : NULL;
+	csr->xs = at[5] ? (int *)(base + at[5]) : NULL;
+	csr->ys = at[6] ? (int *)(base + at[6]) : NULL;
+
+	return (map_check(csr, header->labels_size));
+}
+
+/**
+ * graph_csr_map - maps a binary graph file written by graph_csr_save as a
+ * read-only snapshot, without parsing it or allocating per vertex or edge
+ * Every traversal taking a graph_csr_t runs directly on the mapping, and
+ * the freeze phase is closed on every path out, the failed ones included
+ * @path: the path of the file
+ * Return: a pointer to the snapshot, to be released with graph_csr_unmap,
+ * or NULL on failure
+ */
+
+graph_csr_t *graph_csr_map(const char *path)
+{
+	graph_csr_t *csr;
+	struct stat st;
+	void *base;
+	int fd;
+
+	if (!path)
+		return (NULL);
+	STATS_BEGIN(GRAPH_PHASE_FREEZE);
+	base = MAP_FAILED;
+	fd = open(path, O_RDONLY);
+	if (fd != -1)
+	{
+		if (fstat(fd, &st) == 0 && st.st_size > 0)
+			base = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE,
+				    fd, 0);
+		close(fd);
+	}
+
+	csr = base == MAP_FAILED ? NULL : calloc(1, sizeof(graph_csr_t));
+	if (csr && map_view(csr, base, st.st_size))
+		csr->mapping = base, csr->mapping_size = st.st_size;
+	else if (base != MAP_FAILED)
+		free(csr), csr = NULL, munmap(base, st.st_size);
+	STATS_END(GRAPH_PHASE_FREEZE);
+
+	return (csr);
+}
+
+/**
+ * graph_csr_unmap - releases a snapshot returned by graph_csr_map
+ * @csr: the snapshot
+ */
+
+void graph_csr_unmap(graph_csr_t *csr)
+{
+	if (!csr)
+		return;
+
+	munmap(csr->mapping, csr->mapping_size);
+	free(csr->in_offsets);
+	free(csr->in_srcs);
+	free(csr);
+}
@@ -0,0 +1,154 @@
+#include "graph_csr.h"
+
+/**
+ * graph_file_layout - computes where each array of a binary graph file
+ * starts
+ * @header: the header of the file
+ * @at: array of 7 positions to fill, for offsets, dests, label_offsets,
+ * labels, weights, xs and ys (0 for the arrays the file does not hold)
+ * The sizes come from a header that may have been read from an untrusted
+ * file, so they are bounded first, low enough that no sum below overflows
+ * Return: the total size of the file in bytes, or 0 if the sizes are too
+ * large for any file to hold the arrays
+ */
+
+size_t graph_file_layout(const graph_file_header_t *header, size_t *at)
+{
+	size_t pos = GRAPH_FILE_ALIGN(sizeof(graph_file_header_t));
+	size_t v = header->nb_vertices, e = header->nb_edges;
+
+	if (v > (size_t)-1 / 64 || e > (size_t)-1 / 64 ||
+	    header->labels_size > (size_t)-1 / 4)
+		return (0);
+	at[0] = pos, pos += (v + 1) * sizeof(size_t);
+	at[1] = pos, pos += e * sizeof(size_t);
+	at[2] = pos, pos += v * sizeof(size_t);
+	at[3] = pos, pos = GRAPH_FILE_ALIGN(pos + header->labels_size);
+	at[4] = at[5] = at[6] = 0;
+	if (header->flags & GRAPH_FILE_WEIGHTS)
+		at[4] = pos, pos = GRAPH_FILE_ALIGN(pos + e * sizeof(int));
+	if (header->flags & GRAPH_FILE_COORDS)
+	{
+		at[5] = pos, pos = GRAPH_FILE_ALIGN(pos + v * sizeof(int));
+		at[6] = pos, pos = GRAPH_FILE_ALIGN(pos + v * sizeof(int));
+	}
+
+	return (pos);
+}
+
+/**
+ * write_array - writes an array at a given position of a binary graph file,
+ * padding the file with zeros up to that position first
+ * @file: the file being written
+ * @pos: pointer to the current position in the file, updated
+ * @at: the position the array starts at
+ * @data: the array
+ * @size: the size of the array in bytes
+ * Return: 1 on success, 0 on failure
+ */
+
+static int write_array(FILE *file, size_t *pos, size_t at, const void *data,
+		       size_t size)
+{
+	static const char zeros[8];
+
+	if (at < *pos || at - *pos > sizeof(zeros) ||
+	    fwrite(zeros, 1, at - *pos, file) != at - *pos)
+		return (0);
+	*pos = at + size;
+
+	return (size == 0 || fwrite(data, 1, size, file) == size);
+}
+
+/**
+ * file_header - fills the header of the binary graph file of a snapshot
+ * @csr: the snapshot to write
+ * @header: the header to fill
+ */
+
+static void file_header(const graph_csr_t *csr, graph_file_header_t *header)
+{
+	size_t v, end;
+
+	memset(header, 0, sizeof(*header));
+	header->magic = GRAPH_FILE_MAGIC;
+	header->version = GRAPH_FILE_VERSION;
+	header->word_size = sizeof(size_t);
+	header->flags = (csr->weights ? GRAPH_FILE_WEIGHTS : 0) |
+		(csr->xs && csr->ys ? GRAPH_FILE_COORDS : 0);
+	header->nb_vertices = csr->nb_vertices;
+	header->nb_edges = csr->nb_edges;
+
+	for (v = 0; v < csr->nb_vertices; v++)
+	{
+		end = csr->label_offsets[v] + 1 +
+			strlen(graph_csr_label(csr, v));
+		if (end > header->labels_size)
+			header->labels_size = end;
+	}
+}
+
+/**
+ * graph_csr_save - writes a snapshot to a binary graph file that
+ * graph_csr_map can map back without parsing
+ * @csr: the snapshot to write
+ * @path: the path of the file to create
+ * Return: 1 on success, 0 on failure
+ */
+
+int graph_csr_save(const graph_csr_t *csr, const char *path)
+{
+	graph_file_header_t h;
+	size_t at[7], pos = 0, total, v, e;
+	FILE *file;
+	int ok;
+
+	if (!csr || !path)
+		return (0);
+	file_header(csr, &h);
+	total = graph_file_layout(&h, at);
+	v = csr->nb_vertices, e = csr->nb_edges;
+	file = total ? fopen(path, "wb") : NULL;
+	if (!file)
+		return (0);
+	ok = write_array(file, &pos, 0, &h, sizeof(h)) &&
+		write_array(file, &pos, at[0], csr->offsets,
+			    (v + 1) * sizeof(size_t)) &&
+		write_array(file, &pos, at[1], csr->dests,
+			    e * sizeof(size_t)) &&
+		write_array(file, &pos, at[2], csr->label_offsets,
+			    v * sizeof(size_t)) &&
+		write_array(file, &pos, at[3], csr->labels, h.labels_size) &&
+		(!at[4] || write_array(file, &pos, at[4], csr->weights,
+				       e * sizeof(int))) &&
+		(!at[5] || (write_array(file, &pos, at[5], csr->xs,
+					v * sizeof(int)) &&
+			    write_array(file, &pos, at[6], csr->ys,
+					v * sizeof(int)))) &&
+		write_array(file, &pos, total, NULL, 0);
+	return ((fclose(file) == 0) && ok);
+}
+
+/**
+ * graph_save - writes a graph to a binary graph file
+ * It only sees the graph through graph_freeze, so it saves the graph_t of
+ * whichever project it is built in, weights and coordinates included when
+ * the snapshot has them
+ * @graph: the graph to write
+ * @path: the path of the file to create
+ * Return: 1 on success, 0 on failure
+ */
+
+int graph_save(const struct graph_s *graph, const char *path)
+{
+	graph_csr_t *csr = graph_freeze(graph);
+	int ok;
+
+	if (!csr)
+		return (0);
+
+	ok = graph_csr_save(csr, path);
+	graph_csr_delete(csr);
+
+	return (ok);
+}
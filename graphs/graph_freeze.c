@@ -0,0 +1,173 @@
+#include "graphs.h"
+
+/**
+ * graph_csr_create - allocates an empty compressed-sparse-row snapshot
+ * @nb_vertices: the number of vertices of the snapshot
+ * @nb_edges: the number of edges of the snapshot
+ * @labels_size: the total size of the vertices contents, NUL bytes included
+ * Return: a pointer to the snapshot, or NULL on failure
+ */
+
+graph_csr_t *graph_csr_create(size_t nb_vertices, size_t nb_edges,
+			      size_t labels_size)
+{
+	graph_csr_t *csr = calloc(1, sizeof(graph_csr_t));
+
+	if (!csr)
+		return (NULL);
+
+	csr->nb_vertices = nb_vertices;
+	csr->nb_edges = nb_edges;
+	csr->offsets = malloc((nb_vertices + 1) * sizeof(*csr->offsets));
+	csr->dests = malloc((nb_edges ? nb_edges : 1) * sizeof(*csr->dests));
+	csr->label_offsets = malloc((nb_vertices ? nb_vertices : 1) *
+				    sizeof(*csr->label_offsets));
+	csr->labels = malloc(labels_size ? labels_size : 1);
+
+	if (!csr->offsets || !csr->dests || !csr->label_offsets || !csr->labels)
+	{
+		graph_csr_delete(csr);
+		return (NULL);
+	}
+	STATS_ADD(bytes_allocated, (2 * nb_vertices + 1 + nb_edges) *
+		  sizeof(size_t) + labels_size);
+
+	return (csr);
+}
+
+/**
+ * graph_csr_delete - frees a compressed-sparse-row snapshot
+ * @csr: the snapshot to free
+ */
+
+void graph_csr_delete(graph_csr_t *csr)
+{
+	if (!csr)
+		return;
+
+	if (csr->mapping)
+	{
+		graph_csr_unmap(csr);
+		return;
+	}
+
+	free(csr->offsets);
+	free(csr->dests);
+	free(csr->weights);
+	free(csr->label_offsets);
+	free(csr->labels);
+	free(csr->in_offsets);
+	free(csr->in_srcs);
+	free(csr->xs);
+	free(csr->ys);
+	free(csr);
+}
+
+/**
+ * graph_csr_label - gets the content of a vertex of a snapshot
+ * @csr: the snapshot
+ * @v: the index of the vertex
+ * Return: the content of the vertex
+ */
+
+const char *graph_csr_label(const graph_csr_t *csr, size_t v)
+{
+	return (csr->labels + csr->label_offsets[v]);
+}
+
+/**
+ * graph_freeze - builds an immutable compressed-sparse-row snapshot of
+ * a graph, so that traversals read contiguous arrays instead of chasing
+ * the vertex and edge lists
+ * @graph: the graph to snapshot
+ * Return: a pointer to the snapshot, or NULL on failure
+ */
+
+graph_csr_t *graph_freeze(const graph_t *graph)
+{
+	graph_csr_t *csr;
+	vertex_t *vertex;
+	edge_t *edge;
+	size_t nb_edges = 0, labels_size = 0, e = 0, l = 0, len;
+
+	if (!graph)
+		return (NULL);
+
+	STATS_BEGIN(GRAPH_PHASE_FREEZE);
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+	{
+		nb_edges += vertex->nb_edges;
+		labels_size += vertex->length + 1;
+	}
+
+	csr = graph_csr_create(graph->nb_vertices, nb_edges, labels_size);
+
+	if (!csr)
+	{
+		STATS_END(GRAPH_PHASE_FREEZE);
+		return (NULL);
+	}
+
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+	{
+		csr->offsets[vertex->index] = e;
+		for (edge = vertex->edges; edge; edge = edge->next)
+			csr->dests[e++] = edge->dest->index;
+
+		len = vertex->length + 1;
+		memcpy(csr->labels + l, vertex->content, len);
+		csr->label_offsets[vertex->index] = l;
+		l += len;
+	}
+	csr->offsets[graph->nb_vertices] = e;
+	STATS_END(GRAPH_PHASE_FREEZE);
+
+	return (csr);
+}
+
+/**
+ * graph_csr_add_reverse - builds the reverse adjacency of a snapshot, so
+ * that the sources of the edges reaching a vertex are contiguous too
+ * It writes into the snapshot, so it is called before the snapshot is
+ * shared with readers
+ * @csr: the snapshot
+ * Return: 1 on success, 0 on failure
+ */
+
+int graph_csr_add_reverse(graph_csr_t *csr)
+{
+	size_t v, e, *fill;
+
+	if (!csr)
+		return (0);
+	if (csr->in_offsets)
+		return (1);
+
+	csr->in_offsets = calloc(csr->nb_vertices + 1, sizeof(size_t));
+	csr->in_srcs = malloc((csr->nb_edges ? csr->nb_edges : 1) *
+			      sizeof(size_t));
+	fill = malloc((csr->nb_vertices ? csr->nb_vertices : 1) *
+		      sizeof(size_t));
+	if (!csr->in_offsets || !csr->in_srcs || !fill)
+	{
+		free(csr->in_offsets), free(csr->in_srcs), free(fill);
+		csr->in_offsets = csr->in_srcs = NULL;
+		return (0);
+	}
+	STATS_ADD(bytes_allocated, (2 * csr->nb_vertices + 1 + csr->nb_edges) *
+		  sizeof(size_t));
+
+	for (e = 0; e < csr->nb_edges; e++)
+		csr->in_offsets[csr->dests[e] + 1]++;
+	for (v = 0; v < csr->nb_vertices; v++)
+	{
+		csr->in_offsets[v + 1] += csr->in_offsets[v];
+		fill[v] = csr->in_offsets[v];
+	}
+	for (v = 0; v < csr->nb_vertices; v++)
+		for (e = csr->offsets[v]; e < csr->offsets[v + 1]; e++)
+			csr->in_srcs[fill[csr->dests[e]]++] = v;
+
+	free(fill);
+	return (1);
+}
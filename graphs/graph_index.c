@@ -0,0 +1,93 @@
+#include "graphs.h"
+
+/**
+ * graph_hash - computes the FNV-1a hash of a vertex content, along with
+ * its length, in a single pass
+ * @str: the string to hash
+ * @length: a pointer set to the length of @str
+ * Return: the hash of @str
+ */
+
+size_t graph_hash(const char *str, size_t *length)
+{
+	size_t hash = 2166136261UL;
+	const char *end = str;
+
+	while (*end)
+	{
+		hash ^= (unsigned char)*end++;
+		hash *= 16777619UL;
+	}
+	*length = end - str;
+
+	return (hash);
+}
+
+/**
+ * graph_index_slot - finds the slot of a vertex in the graph index, the
+ * hash and length of its content being known, or the empty slot it would
+ * take, so that a content can be looked up and inserted with one probe
+ * Only the vertices with the same hash and length have their content
+ * compared, so a miss never reads a content
+ * @graph: the graph to search, whose index is not empty
+ * @str: the content of the vertex to look for
+ * @hash: the hash of @str
+ * @length: the length of @str
+ * Return: a pointer to the slot holding the vertex, or to an empty slot
+ * if it is not in the graph
+ */
+
+vertex_t **graph_index_slot(const graph_t *graph, const char *str,
+			    size_t hash, size_t length)
+{
+	size_t mask = graph->index_size - 1, slot = hash & mask;
+	vertex_t *vertex;
+
+	while ((vertex = graph->index[slot]) != NULL)
+	{
+		if (vertex->hash == hash && vertex->length == length &&
+		    memcmp(vertex->content, str, length) == 0)
+			break;
+		slot = (slot + 1) & mask;
+	}
+
+	return (graph->index + slot);
+}
+
+/**
+ * graph_index_lookup - looks up a vertex by its content in the graph
+ * index, the hash and length of the content being known
+ * @graph: the graph to search
+ * @str: the content of the vertex to look for
+ * @hash: the hash of @str
+ * @length: the length of @str
+ * Return: a pointer to the vertex, or NULL if it is not in the graph
+ */
+
+vertex_t *graph_index_lookup(const graph_t *graph, const char *str,
+			     size_t hash, size_t length)
+{
+	if (graph->index_size == 0)
+		return (NULL);
+
+	return (*graph_index_slot(graph, str, hash, length));
+}
+
+/**
+ * graph_index_find - looks up a vertex by its content in the graph index
+ * @graph: the graph to search
+ * @str: the content of the vertex to look for
+ * Return: a pointer to the vertex, or NULL if it is not in the graph
+ */
+
+vertex_t *graph_index_find(const graph_t *graph, const char *str)
+{
+	size_t hash, length;
+
+	if (!graph || !str)
+		return (NULL);
+
+	hash = graph_hash(str, &length);
+
+	return (graph_index_lookup(graph, str, hash, length));
+}
@@ -0,0 +1,71 @@
+#include "graphs.h"
+
+/**
+ * graph_index_reserve - makes the graph index large enough to hold a
+ * number of vertices while staying at most half full, rehashing every
+ * vertex of the graph into it at once if it has to grow
+ * @graph: the graph whose index should grow
+ * @count: the number of vertices the index should hold
+ * Return: 1 on success, 0 on failure
+ */
+
+int graph_index_reserve(graph_t *graph, size_t count)
+{
+	size_t size, mask, slot;
+	vertex_t **index, *vertex;
+
+	size = graph->index_size ? graph->index_size : GRAPH_INDEX_MIN_SIZE;
+	while (count * 2 > size)
+		size *= 2;
+	if (size == graph->index_size)
+		return (1);
+	index = calloc(size, sizeof(*index));
+
+	if (!index)
+		return (0);
+
+	mask = size - 1;
+
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+	{
+		slot = vertex->hash & mask;
+
+		while (index[slot])
+			slot = (slot + 1) & mask;
+
+		index[slot] = vertex;
+	}
+
+	free(graph->index);
+	graph->index = index;
+	graph->index_size = size;
+
+	return (1);
+}
+
+/**
+ * graph_index_insert - registers a vertex in the graph index
+ * The index is kept at most half full so that probe sequences stay short
+ * @graph: the graph owning the index
+ * @vertex: the vertex to register, not yet counted in nb_vertices
+ * Return: 1 on success, 0 on failure
+ */
+
+int graph_index_insert(graph_t *graph, vertex_t *vertex)
+{
+	size_t mask, slot;
+
+	if ((graph->nb_vertices + 1) * 2 > graph->index_size &&
+	    !graph_index_reserve(graph, graph->nb_vertices + 1))
+		return (0);
+
+	mask = graph->index_size - 1;
+	slot = vertex->hash & mask;
+
+	while (graph->index[slot])
+		slot = (slot + 1) & mask;
+
+	graph->index[slot] = vertex;
+
+	return (1);
+}
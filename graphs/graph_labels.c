@@ -0,0 +1,58 @@
+#include "graphs.h"
+
+/**
+ * graph_intern - copies a vertex content into the label pool of a graph,
+ * a list of blocks each twice as large as the previous one, so that long
+ * contents cost no allocation of their own
+ * Contents are unique within a graph, so each one is stored once
+ * @graph: the graph that will own the copy
+ * @str: the content
+ * @length: the length of @str
+ * Return: a pointer to the copy, or NULL on failure
+ */
+
+char *graph_intern(graph_t *graph, const char *str, size_t length)
+{
+	graph_slab_t *block = graph->labels;
+	size_t size;
+	char *copy;
+
+	if (!block || block->size - block->used < length + 1)
+	{
+		size = block ? block->size * 2 : GRAPH_LABELS_MIN_SIZE;
+		if (size > GRAPH_SLAB_MAX_SIZE)
+			size = GRAPH_SLAB_MAX_SIZE;
+		if (size < length + 1)
+			size = length + 1;
+		block = malloc(sizeof(graph_slab_t) + size);
+		if (!block)
+			return (NULL);
+		STATS_ADD(bytes_allocated, sizeof(graph_slab_t) + size);
+		block->next = graph->labels;
+		block->size = size;
+		block->used = 0;
+		graph->labels = block;
+	}
+	copy = (char *)(block + 1) + block->used;
+	memcpy(copy, str, length + 1);
+	block->used += length + 1;
+	return (copy);
+}
+
+/**
+ * graph_labels_delete - frees the label pool of a graph
+ * @graph: the graph owning the pool
+ */
+
+void graph_labels_delete(graph_t *graph)
+{
+	graph_slab_t *block = graph->labels, *next;
+
+	while (block)
+	{
+		next = block->next;
+		free(block);
+		block = next;
+	}
+	graph->labels = NULL;
+}
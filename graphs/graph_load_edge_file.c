@@ -0,0 +1,106 @@
+#include "graphs.h"
+#include <ctype.h>
+
+/**
+ * read_file - reads a whole file into a NUL-terminated buffer
+ * @path: the path of the file
+ * Return: the buffer, to be freed by the caller, or NULL on failure
+ */
+
+static char *read_file(const char *path)
+{
+	FILE *file = fopen(path, "rb");
+	char *buffer = NULL;
+	long size;
+
+	if (!file)
+		return (NULL);
+
+	if (fseek(file, 0, SEEK_END) == 0 && (size = ftell(file)) >= 0 &&
+	    fseek(file, 0, SEEK_SET) == 0)
+	{
+		buffer = malloc(size + 1);
+		if (buffer && fread(buffer, 1, size, file) != (size_t)size)
+			free(buffer), buffer = NULL;
+		if (buffer)
+			buffer[size] = '\0';
+	}
+
+	fclose(file);
+	return (buffer);
+}
+
+/**
+ * split_words - splits a buffer in place into whitespace-separated words,
+ * skipping the lines that start with a '#'
+ * @buffer: the buffer to split
+ * @words: array to fill with the words, or NULL to only count them
+ * Return: the number of words
+ */
+
+static size_t split_words(char *buffer, char **words)
+{
+	size_t count = 0;
+	char *p = buffer;
+
+	while (*p)
+	{
+		if (*p == '#' && (p == buffer || p[-1] == '\n'))
+		{
+			while (*p && *p != '\n')
+				p++;
+			continue;
+		}
+		if (isspace((unsigned char)*p))
+		{
+			if (words)
+				*p = '\0';
+			p++;
+			continue;
+		}
+		if (words)
+			words[count] = p;
+		count++;
+		while (*p && !isspace((unsigned char)*p))
+			p++;
+	}
+
+	return (count);
+}
+
+/**
+ * graph_load_edge_file - loads a whitespace-separated edge list file into
+ * a graph, each edge being a source content followed by a destination
+ * content; lines starting with a '#' are comments
+ * @graph: the graph to load the edges into
+ * @path: the path of the edge list file
+ * @type: the type of every edge (UNIDIRECTIONAL or BIDIRECTIONAL)
+ * Return: 1 on success, 0 on failure
+ */
+
+int graph_load_edge_file(graph_t *graph, const char *path, edge_type_t type)
+{
+	char *buffer, **words;
+	size_t count;
+	int ok = 0;
+
+	if (!graph || !path)
+		return (0);
+
+	buffer = read_file(path);
+	if (!buffer)
+		return (0);
+
+	count = split_words(buffer, NULL);
+	words = malloc((count ? count : 1) * sizeof(*words));
+	if (words && count % 2 == 0)
+	{
+		split_words(buffer, words);
+		ok = graph_load_edge_list(graph, (const char **)words,
+					  count / 2, type);
+	}
+
+	free(words);
+	free(buffer);
+	return (ok);
+}
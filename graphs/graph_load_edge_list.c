@@ -0,0 +1,169 @@
+#include "graphs.h"
+
+/**
+ * intern_vertex - gets the vertex of a content, adding it if needed
+ * The content is hashed and probed for once: a miss leaves the empty slot
+ * the new vertex takes. New vertices are carved from blocks as large as
+ * the graph so far, and no larger than the endpoints still to intern
+ * @graph: the graph being loaded, whose index has room for them all
+ * @str: the content of the vertex
+ * @block: the next free vertex of the current block, moved past it
+ * @left: the number of free vertices in the current block
+ * @remaining: the number of endpoints still to intern, this one included
+ * Return: a pointer to the vertex, or NULL on failure
+ */
+
+static vertex_t *intern_vertex(graph_t *graph, const char *str,
+			       vertex_t **block, size_t *left,
+			       size_t remaining)
+{
+	size_t hash, length, size;
+	vertex_t **slot, *vertex;
+
+	hash = graph_hash(str, &length);
+	slot = graph_index_slot(graph, str, hash, length);
+	if (*slot)
+		return (*slot);
+	if (*left == 0)
+	{
+		size = graph->nb_vertices > GRAPH_LOAD_BLOCK_MIN ?
+			graph->nb_vertices : GRAPH_LOAD_BLOCK_MIN;
+		*left = size < remaining ? size : remaining;
+		*block = graph_alloc_block(graph, *left * sizeof(vertex_t));
+		if (!*block)
+			return (*left = 0, NULL);
+	}
+	vertex = (*block)++, (*left)--;
+	if (!graph_vertex_init(graph, vertex, str, hash, length))
+		return (NULL);
+
+	*slot = vertex;
+	vertex->index = graph->nb_vertices;
+	if (graph->nb_vertices == 0)
+		graph->vertices = vertex;
+	else
+		graph->tail->next = vertex;
+	graph->tail = vertex, graph->nb_vertices++;
+	return (vertex);
+}
+
+/**
+ * intern_pairs - resolves every endpoint of an edge list to its vertex,
+ * adding the vertices that are not in the graph yet
+ * The index is sized up front for every endpoint being a new vertex, so
+ * it never grows while the endpoints are interned
+ * @graph: the graph being loaded
+ * @pairs: the edge list, 2 * @n contents
+ * @n: the number of edges
+ * @ends: array of 2 * @n vertices to fill
+ * Return: 1 on success, 0 on failure
+ */
+
+static int intern_pairs(graph_t *graph, const char **pairs, size_t n,
+			vertex_t **ends)
+{
+	vertex_t *block = NULL;
+	size_t i, left = 0;
+
+	if (!graph_index_reserve(graph, graph->nb_vertices + 2 * n))
+		return (0);
+	for (i = 0; i < 2 * n; i++)
+	{
+		if (!pairs[i])
+			return (0);
+		ends[i] = intern_vertex(graph, pairs[i], &block, &left,
+					2 * n - i);
+		if (!ends[i])
+			return (0);
+	}
+
+	return (1);
+}
+
+/**
+ * link_pairs - creates and links the edges of an interned edge list
+ * All the edges are carved from a single block of graph_alloc_block.
+ * Self-loops are skipped, as graph_add_edge rejects them, and in
+ * GRAPH_UNIQUE_EDGES mode so are the edges graph_edge_is_duplicate tells
+ * apart, both directions of a BIDIRECTIONAL edge together
+ * @graph: the graph being loaded
+ * @ends: the source and destination vertices of each edge
+ * @n: the number of edges
+ * @type: the type of the edges
+ * Return: 1 on success, 0 on failure
+ */
+
+static int link_pairs(graph_t *graph, vertex_t **ends, size_t n,
+		      edge_type_t type)
+{
+	size_t i, count = type == BIDIRECTIONAL ? 2 * n : n;
+	edge_t *block, *edge;
+	vertex_t *src, *dest;
+	int rev, skip = 0;
+
+	block = graph_alloc_block(graph, count * sizeof(edge_t));
+	if (!block)
+		return (0);
+	for (i = 0; i < count; i++)
+	{
+		if (type == BIDIRECTIONAL)
+			src = ends[i], dest = ends[i ^ 1];
+		else
+			src = ends[2 * i], dest = ends[2 * i + 1];
+		rev = type == BIDIRECTIONAL && i & 1;
+		if (src == dest)
+			continue;
+		if (graph->flags & GRAPH_UNIQUE_EDGES)
+		{
+			if (!rev)
+				skip = graph_edge_is_duplicate(graph, src, dest,
+							       type);
+			if (skip)
+				continue;
+			if (!graph_edge_set_reserve(graph))
+				return (0);
+		}
+		edge = block + i;
+		edge->dest = dest;
+		graph_link_edge(graph, src, edge);
+	}
+
+	return (1);
+}
+
+/**
+ * graph_load_edge_list - adds a whole list of edges to a graph at once,
+ * creating the vertices that do not exist yet
+ * Endpoints are interned in one pass, each one hashed once, then every
+ * edge is appended in O(1)
+ * @graph: the graph to load the edges into
+ * @pairs: 2 * @n contents, the source and destination of each edge
+ * @n: the number of edges
+ * @type: the type of every edge (UNIDIRECTIONAL or BIDIRECTIONAL)
+ * Return: 1 on success, 0 on failure, in which case only part of the
+ * list may have been loaded
+ */
+
+int graph_load_edge_list(graph_t *graph, const char **pairs, size_t n,
+			 edge_type_t type)
+{
+	vertex_t **ends;
+	int ok;
+
+	if (!graph || (!pairs && n) ||
+	    type < UNIDIRECTIONAL || type > BIDIRECTIONAL)
+		return (0);
+	if (n == 0)
+		return (1);
+
+	ends = malloc(2 * n * sizeof(*ends));
+	if (!ends)
+		return (0);
+	STATS_BEGIN(GRAPH_PHASE_LOAD);
+	ok = intern_pairs(graph, pairs, n, ends) &&
+		link_pairs(graph, ends, n, type);
+	STATS_END(GRAPH_PHASE_LOAD);
+
+	free(ends);
+	return (ok);
+}
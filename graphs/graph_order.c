@@ -0,0 +1,142 @@
+#include "graphs.h"
+
+/**
+ * degree_ascending - qsort comparator ordering vertices by increasing
+ * out-degree, ties broken by index
+ * @a: a pointer to the first vertex pointer
+ * @b: a pointer to the second vertex pointer
+ * Return: negative, zero or positive as for qsort
+ */
+
+static int degree_ascending(const void *a, const void *b)
+{
+	const vertex_t *u = *(vertex_t * const *)a, *v = *(vertex_t * const *)b;
+
+	if (u->nb_edges != v->nb_edges)
+		return (u->nb_edges < v->nb_edges ? -1 : 1);
+	return (u->index < v->index ? -1 : u->index > v->index);
+}
+
+/**
+ * degree_descending - qsort comparator ordering vertices by decreasing
+ * out-degree, ties broken by index
+ * @a: a pointer to the first vertex pointer
+ * @b: a pointer to the second vertex pointer
+ * Return: negative, zero or positive as for qsort
+ */
+
+static int degree_descending(const void *a, const void *b)
+{
+	const vertex_t *u = *(vertex_t * const *)a, *v = *(vertex_t * const *)b;
+
+	if (u->nb_edges != v->nb_edges)
+		return (u->nb_edges > v->nb_edges ? -1 : 1);
+	return (u->index < v->index ? -1 : u->index > v->index);
+}
+
+/**
+ * order_from - appends the vertices reachable from a root to an order in
+ * breadth-first order, the order itself serving as the queue
+ * @root: the vertex to start from, not seen yet
+ * @order: the order being built
+ * @size: the number of vertices already in @order
+ * @seen: bitset of the vertices already in @order, by index
+ * @by_degree: if nonzero, the neighbours discovered from each vertex are
+ * appended by increasing degree, as Cuthill-McKee does
+ * Return: the new number of vertices in @order
+ */
+
+static size_t order_from(vertex_t *root, vertex_t **order, size_t size,
+			 unsigned char *seen, int by_degree)
+{
+	size_t head = size, first;
+	const edge_t *edge;
+
+	order[size++] = root, BITSET_SET(seen, root->index);
+	for (; head < size; head++)
+	{
+		first = size;
+		for (edge = order[head]->edges; edge; edge = edge->next)
+		{
+			if (BITSET_TEST(seen, edge->dest->index))
+				continue;
+			BITSET_SET(seen, edge->dest->index);
+			order[size++] = edge->dest;
+		}
+		if (by_degree && size - first > 1)
+			qsort(order + first, size - first, sizeof(*order),
+			      degree_ascending);
+	}
+	return (size);
+}
+
+/**
+ * order_all - orders every vertex by breadth-first searches from the roots
+ * not reached yet, taken in order
+ * @roots: all the vertices, in the order to try them as roots
+ * @order: the order to build
+ * @n: the number of vertices
+ * @seen: zeroed bitset of nb_vertices bits
+ * @by_degree: if nonzero, Cuthill-McKee order is built, reversed
+ */
+
+static void order_all(vertex_t **roots, vertex_t **order, size_t n,
+		      unsigned char *seen, int by_degree)
+{
+	size_t size = 0, i;
+	vertex_t *vertex;
+
+	for (i = 0; i < n; i++)
+		if (!BITSET_TEST(seen, roots[i]->index))
+			size = order_from(roots[i], order, size, seen,
+					  by_degree);
+	for (i = 0; by_degree && i < n / 2; i++)
+	{
+		vertex = order[i];
+		order[i] = order[n - 1 - i];
+		order[n - 1 - i] = vertex;
+	}
+}
+
+/**
+ * graph_order - computes a locality-improving order of the vertices of a
+ * graph, following out-edges; vertices unreachable from the earlier roots
+ * start new breadth-first searches, from the lowest index for
+ * GRAPH_ORDER_BFS and from the lowest degree for GRAPH_ORDER_RCM
+ * @graph: the graph
+ * @strategy: the order to compute
+ * Return: an array of the nb_vertices vertices in their new order, to be
+ * freed by the caller, NULL on failure
+ */
+
+vertex_t **graph_order(const graph_t *graph, graph_order_t strategy)
+{
+	vertex_t **order, **roots, *vertex;
+	size_t n = graph->nb_vertices, i = 0;
+	unsigned char *seen;
+
+	order = malloc(n * sizeof(*order)), roots = malloc(n * sizeof(*roots));
+	seen = calloc(n / 8 + 1, 1);
+	if (order && roots && seen)
+	{
+		for (vertex = graph->vertices; vertex; vertex = vertex->next)
+			roots[i++] = vertex;
+		if (strategy == GRAPH_ORDER_DEGREE)
+		{
+			qsort(roots, n, sizeof(*roots), degree_descending);
+			memcpy(order, roots, n * sizeof(*order));
+		}
+		else
+		{
+			if (strategy == GRAPH_ORDER_RCM)
+				qsort(roots, n, sizeof(*roots),
+				      degree_ascending);
+			order_all(roots, order, n, seen,
+				  strategy == GRAPH_ORDER_RCM);
+		}
+	}
+	else
+		free(order), order = NULL;
+	free(roots), free(seen);
+	return (order);
+}
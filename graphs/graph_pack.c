@@ -0,0 +1,171 @@
+#include "graphs.h"
+
+/**
+ * index_ascending - qsort comparator of vertex indices
+ * @a: a pointer to the first index
+ * @b: a pointer to the second index
+ * Return: negative, zero or positive as for qsort
+ */
+
+static int index_ascending(const void *a, const void *b)
+{
+	size_t x = *(const size_t *)a, y = *(const size_t *)b;
+
+	return (x < y ? -1 : x > y);
+}
+
+/**
+ * pack_value - appends a number to the encoding of a neighbour list
+ * @ctrl: the control bytes of the list, zeroed beforehand
+ * @data: where to write the number
+ * @k: the position of the number in the list
+ * @x: the number, below 2^32
+ * Return: the number of bytes written
+ */
+
+static size_t pack_value(unsigned char *ctrl, unsigned char *data, size_t k,
+			 size_t x)
+{
+	size_t code = x < 0x100 ? 0 : x < 0x10000 ? 1 : x < 0x1000000 ? 2 : 3;
+	size_t i;
+
+	ctrl[k >> 2] |= code << ((k & 3) << 1);
+	for (i = 0; i <= code; i++, x >>= 8)
+		data[i] = (unsigned char)x;
+
+	return (code + 1);
+}
+
+/**
+ * pack_vertex - sorts the neighbours of a vertex and appends their
+ * encoding to the bytes of a delta-compressed snapshot
+ * @packed: the snapshot being built
+ * @csr: the snapshot being compressed
+ * @v: the index of the vertex
+ * @scratch: an array large enough for the neighbours of any vertex
+ * @capacity: the number of bytes @packed->bytes can hold, updated
+ * Return: 1 on success, 0 on failure
+ */
+
+static int pack_vertex(graph_packed_t *packed, const graph_csr_t *csr,
+		       size_t v, size_t *scratch, size_t *capacity)
+{
+	size_t n = csr->offsets[v + 1] - csr->offsets[v], k, x, need;
+	unsigned char *bytes, *ctrl;
+
+	packed->offsets[v] = packed->size;
+	if (n == 0)
+		return (1);
+	need = packed->size + VARINT_MAX_SIZE + (n + 3) / 4 + 4 * n;
+	if (need + PACKED_PADDING > *capacity)
+	{
+		*capacity = 2 * *capacity > need + PACKED_PADDING ?
+			2 * *capacity : need + PACKED_PADDING;
+		bytes = realloc(packed->bytes, *capacity);
+		if (!bytes)
+			return (0);
+		packed->bytes = bytes;
+	}
+
+	memcpy(scratch, csr->dests + csr->offsets[v], n * sizeof(size_t));
+	qsort(scratch, n, sizeof(size_t), index_ascending);
+	packed->size += graph_varint_put(packed->bytes + packed->size, n);
+	ctrl = packed->bytes + packed->size;
+	memset(ctrl, 0, (n + 3) / 4);
+	packed->size += (n + 3) / 4;
+	for (k = 0; k < n; k++)
+	{
+		x = k ? scratch[k] - scratch[k - 1] : scratch[0] >= v ?
+			(scratch[0] - v) << 1 : ((v - scratch[0]) << 1) - 1;
+		packed->size += pack_value(ctrl, packed->bytes + packed->size,
+					   k, x);
+	}
+	return (1);
+}
+
+/**
+ * pack_labels - copies the contents of the vertices of a snapshot into
+ * a delta-compressed one, so that it does not depend on the former
+ * @packed: the snapshot being built
+ * @csr: the snapshot being compressed
+ * Return: 1 on success, 0 on failure
+ */
+
+static int pack_labels(graph_packed_t *packed, const graph_csr_t *csr)
+{
+	size_t v, size = 0, len;
+
+	for (v = 0; v < csr->nb_vertices; v++)
+		size += strlen(graph_csr_label(csr, v)) + 1;
+	packed->label_offsets = malloc((csr->nb_vertices ? csr->nb_vertices :
+					1) * sizeof(size_t));
+	packed->labels = malloc(size ? size : 1);
+	if (!packed->label_offsets || !packed->labels)
+		return (0);
+	STATS_ADD(bytes_allocated, csr->nb_vertices * sizeof(size_t) + size);
+
+	for (size = 0, v = 0; v < csr->nb_vertices; v++)
+	{
+		len = strlen(graph_csr_label(csr, v)) + 1;
+		memcpy(packed->labels + size, graph_csr_label(csr, v), len);
+		packed->label_offsets[v] = size;
+		size += len;
+	}
+	return (1);
+}
+
+/**
+ * graph_csr_pack - builds a read-only snapshot of a compressed-sparse-row
+ * one whose neighbour lists are sorted and stored as gaps of 1 to 4 bytes,
+ * which takes two or three bytes per edge instead of a size_t, so that
+ * graphs whose snapshot does not fit in memory do; it also works on mapped
+ * snapshots, of at most PACKED_MAX_VERTICES vertices so that every number
+ * fits in 4 bytes; on the Erdos-Renyi graphs of the bench, scales 16 to 18,
+ * its breadth-first traversal takes 0.7 to 1.5 times as long as the CSR one
+ * @csr: the snapshot to compress
+ * Return: a pointer to the compressed snapshot, or NULL on failure
+ */
+
+graph_packed_t *graph_csr_pack(const graph_csr_t *csr)
+{
+	graph_packed_t *packed;
+	size_t v, degree, capacity, *scratch;
+	void *shrunk;
+	int ok;
+
+	if (!csr || csr->nb_vertices > PACKED_MAX_VERTICES ||
+	    !(packed = calloc(1, sizeof(graph_packed_t))))
+		return (NULL);
+	packed->nb_vertices = csr->nb_vertices;
+	packed->nb_edges = csr->nb_edges;
+	for (v = 0; v < csr->nb_vertices; v++)
+		if ((degree = csr->offsets[v + 1] - csr->offsets[v]) >
+		    packed->max_degree)
+			packed->max_degree = degree;
+	capacity = 2 * csr->nb_edges + VARINT_MAX_SIZE + PACKED_PADDING;
+	packed->offsets = malloc((csr->nb_vertices + 1) * sizeof(size_t));
+	packed->bytes = malloc(capacity);
+	scratch = malloc((packed->max_degree + 1) * sizeof(size_t));
+
+	STATS_BEGIN(GRAPH_PHASE_FREEZE);
+	ok = packed->offsets && packed->bytes && scratch;
+	for (v = 0; ok && v < csr->nb_vertices; v++)
+		ok = pack_vertex(packed, csr, v, scratch, &capacity);
+	free(scratch);
+	if (ok)
+	{
+		packed->offsets[csr->nb_vertices] = packed->size;
+		memset(packed->bytes + packed->size, 0, PACKED_PADDING);
+		shrunk = realloc(packed->bytes, packed->size + PACKED_PADDING);
+		if (shrunk)
+			packed->bytes = shrunk;
+		STATS_ADD(bytes_allocated, (csr->nb_vertices + 1) *
+			  sizeof(size_t) + packed->size + PACKED_PADDING);
+	}
+	ok = ok && pack_labels(packed, csr);
+	STATS_END(GRAPH_PHASE_FREEZE);
+
+	if (!ok)
+		graph_packed_delete(packed), packed = NULL;
+	return (packed);
+}
@@ -0,0 +1,76 @@
+#include "graphs.h"
+
+/**
+ * graph_varint_put - encodes a number as a varint
+ * @out: where to write the encoding, at least VARINT_MAX_SIZE bytes
+ * @value: the number to encode
+ * Return: the number of bytes written
+ */
+
+size_t graph_varint_put(unsigned char *out, size_t value)
+{
+	size_t n = 0;
+
+	while (value >= 0x80)
+	{
+		out[n++] = (unsigned char)(value | 0x80);
+		value >>= 7;
+	}
+	out[n++] = (unsigned char)value;
+
+	return (n);
+}
+
+/**
+ * graph_varint_get - decodes a varint
+ * VARINT_GET only calls it for numbers spanning several bytes
+ * @p: a pointer to the position of the encoding, moved past it
+ * Return: the decoded number
+ */
+
+size_t graph_varint_get(const unsigned char **p)
+{
+	const unsigned char *q = *p;
+	size_t value = 0;
+	unsigned int shift = 0;
+
+	while (*q & 0x80)
+	{
+		value |= (size_t)(*q++ & 0x7f) << shift;
+		shift += 7;
+	}
+	value |= (size_t)*q++ << shift;
+	*p = q;
+
+	return (value);
+}
+
+/**
+ * graph_packed_delete - frees a delta-compressed snapshot
+ * @packed: the snapshot to free
+ */
+
+void graph_packed_delete(graph_packed_t *packed)
+{
+	if (!packed)
+		return;
+
+	free(packed->offsets);
+	free(packed->bytes);
+	free(packed->label_offsets);
+	free(packed->labels);
+	free(packed);
+}
+
+/**
+ * graph_packed_label - gets the content of a vertex of a delta-compressed
+ * snapshot
+ * @packed: the snapshot
+ * @v: the index of the vertex
+ * Return: the content of the vertex
+ */
+
+const char *graph_packed_label(const graph_packed_t *packed, size_t v)
+{
+	return (packed->labels + packed->label_offsets[v]);
+}
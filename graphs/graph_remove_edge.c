@@ -0,0 +1,76 @@
+#include "graphs.h"
+
+/**
+ * edge_set_remove - removes an edge from the edge set of a graph, shifting
+ * back the entries of its probe sequence so that no tombstone is needed
+ * @graph: the graph
+ * @src: the source vertex of the edge
+ * @dest: the destination vertex of the edge
+ */
+
+static void edge_set_remove(graph_t *graph, const vertex_t *src,
+			    const vertex_t *dest)
+{
+	edge_key_t *set = graph->edge_set;
+	size_t mask = graph->edge_set_size - 1, hole, slot, home;
+	const edge_key_t *key = graph_edge_set_find(graph, src, dest);
+
+	if (!key)
+		return;
+	hole = key - set;
+	for (slot = (hole + 1) & mask; set[slot].src; slot = (slot + 1) & mask)
+	{
+		home = EDGE_HASH(set[slot].src, set[slot].dest) & mask;
+		if (((slot - home) & mask) >= ((slot - hole) & mask))
+		{
+			set[hole] = set[slot];
+			hole = slot;
+		}
+	}
+	set[hole].src = NULL, set[hole].dest = NULL;
+	graph->nb_edge_keys--;
+}
+
+/**
+ * graph_remove_edge - removes the first edge from a vertex to another, in
+ * O(out-degree of the source)
+ * The edge is released through graph_free, so in arena mode its memory is
+ * only reclaimed by graph_delete
+ * @graph: the graph
+ * @src: the content of the source vertex
+ * @dest: the content of the destination vertex
+ * Return: 1 if an edge was removed, 0 otherwise
+ */
+
+int graph_remove_edge(graph_t *graph, const char *src, const char *dest)
+{
+	vertex_t *src_vertex, *dest_vertex;
+	edge_t *edge, *prev = NULL;
+
+	if (!graph || !src || !dest)
+		return (0);
+	src_vertex = graph_index_find(graph, src);
+	dest_vertex = graph_index_find(graph, dest);
+	if (!src_vertex || !dest_vertex)
+		return (0);
+	for (edge = src_vertex->edges; edge && edge->dest != dest_vertex;
+	     edge = edge->next)
+		prev = edge;
+	if (!edge)
+		return (0);
+	if (prev)
+		prev->next = edge->next;
+	else
+		src_vertex->edges = edge->next;
+	if (src_vertex->edges_tail == edge)
+		src_vertex->edges_tail = prev;
+	src_vertex->nb_edges--;
+	graph_free(graph, edge);
+	for (edge = prev ? prev->next : src_vertex->edges; edge;
+	     edge = edge->next)
+		if (edge->dest == dest_vertex)
+			return (1);
+	if (graph->flags & GRAPH_UNIQUE_EDGES)
+		edge_set_remove(graph, src_vertex, dest_vertex);
+	return (1);
+}
@@ -0,0 +1,85 @@
+#include "graphs.h"
+
+/**
+ * edge_ascending - qsort comparator ordering edges by destination index
+ * @a: a pointer to the first edge pointer
+ * @b: a pointer to the second edge pointer
+ * Return: negative, zero or positive as for qsort
+ */
+
+static int edge_ascending(const void *a, const void *b)
+{
+	size_t u = (*(edge_t * const *)a)->dest->index;
+	size_t v = (*(edge_t * const *)b)->dest->index;
+
+	return (u < v ? -1 : u > v);
+}
+
+/**
+ * sort_edges - relinks the edge list of a vertex by destination index
+ * @vertex: the vertex
+ * @scratch: room for at least nb_edges edge pointers
+ */
+
+static void sort_edges(vertex_t *vertex, edge_t **scratch)
+{
+	edge_t *edge;
+	size_t i;
+
+	if (vertex->nb_edges < 2)
+		return;
+	for (i = 0, edge = vertex->edges; edge; edge = edge->next)
+		scratch[i++] = edge;
+	qsort(scratch, i, sizeof(*scratch), edge_ascending);
+	for (i = 0; i + 1 < vertex->nb_edges; i++)
+		scratch[i]->next = scratch[i + 1];
+	scratch[i]->next = NULL;
+	vertex->edges = scratch[0];
+	vertex->edges_tail = scratch[i];
+}
+
+/**
+ * graph_reorder - renumbers the vertices of a graph in a locality-improving
+ * order, so that vertices visited together get close indices: the vertex
+ * list is relinked in the new order and every edge list is sorted by
+ * destination index, which graph_freeze then carries into the CSR arrays.
+ * Names, edges and the vertex and edge hash sets are unchanged
+ * @graph: the graph
+ * @strategy: the order to renumber the vertices by
+ * Return: 1 on success, 0 on failure, the graph being left untouched
+ */
+
+int graph_reorder(graph_t *graph, graph_order_t strategy)
+{
+	vertex_t **order;
+	edge_t **scratch;
+	size_t i, n, max_degree = 0;
+
+	if (!graph || graph->nb_vertices == 0)
+		return (0);
+	n = graph->nb_vertices;
+	order = graph_order(graph, strategy);
+	if (!order)
+		return (0);
+	for (i = 0; i < n; i++)
+		if (order[i]->nb_edges > max_degree)
+			max_degree = order[i]->nb_edges;
+	scratch = malloc((max_degree + 1) * sizeof(*scratch));
+	if (!scratch)
+	{
+		free(order);
+		return (0);
+	}
+	for (i = 0; i < n; i++)
+	{
+		order[i]->index = i;
+		order[i]->next = i + 1 < n ? order[i + 1] : NULL;
+	}
+	graph->vertices = order[0];
+	graph->tail = order[n - 1];
+	for (i = 0; i < n; i++)
+		sort_edges(order[i], scratch);
+	free(scratch);
+	free(order);
+	return (1);
+}
@@ -0,0 +1,93 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "graph_stats.h"
+
+graph_stats_t graph_stats;
+__thread double graph_stats_start[GRAPH_NB_PHASES];
+
+/**
+ * graph_stats_reset - zeroes every counter of graph_stats
+ */
+
+void graph_stats_reset(void)
+{
+	memset(&graph_stats, 0, sizeof(graph_stats));
+}
+
+/**
+ * graph_stats_now - reads the monotonic clock
+ * Return: the current time in seconds
+ */
+
+double graph_stats_now(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec + now.tv_nsec / 1e9);
+}
+
+/**
+ * graph_stats_peak - raises the peak frontier of graph_stats to a size if
+ * it is larger, even while other threads do the same
+ * @n: the size of a queue, stack, frontier or heap
+ */
+
+void graph_stats_peak(size_t n)
+{
+	size_t peak = __atomic_load_n(&graph_stats.peak_frontier,
+				      __ATOMIC_RELAXED);
+
+	while (n > peak &&
+	       !__sync_bool_compare_and_swap(&graph_stats.peak_frontier,
+					     peak, n))
+		peak = __atomic_load_n(&graph_stats.peak_frontier,
+				       __ATOMIC_RELAXED);
+}
+
+/**
+ * graph_stats_end - adds the time since the calling thread began a phase
+ * to the time of the phase, even while other threads do the same
+ * @phase: the phase
+ */
+
+void graph_stats_end(graph_phase_t phase)
+{
+	double *total = &graph_stats.phase_time[phase];
+	double elapsed = graph_stats_now() - graph_stats_start[phase];
+	double seen, sum;
+
+	__atomic_load(total, &seen, __ATOMIC_RELAXED);
+	do {
+		sum = seen + elapsed;
+	} while (!__atomic_compare_exchange(total, &seen, &sum, 0,
+					    __ATOMIC_RELAXED,
+					    __ATOMIC_RELAXED));
+}
+
+/**
+ * graph_stats_print - prints the counters of graph_stats, which stay at 0
+ * unless built with -DGRAPH_STATS
+ * @stream: the stream to print to
+ */
+
+void graph_stats_print(FILE *stream)
+{
+	static const char * const phases[GRAPH_NB_PHASES] = {
+		"load", "freeze", "traverse", "search"
+	};
+	int phase;
+
+	fprintf(stream, "vertices visited: %lu\n",
+		(unsigned long)graph_stats.vertices_visited);
+	fprintf(stream, "edges scanned: %lu\n",
+		(unsigned long)graph_stats.edges_scanned);
+	fprintf(stream, "peak frontier: %lu\n",
+		(unsigned long)graph_stats.peak_frontier);
+	fprintf(stream, "bytes allocated: %lu\n",
+		(unsigned long)graph_stats.bytes_allocated);
+	for (phase = 0; phase < GRAPH_NB_PHASES; phase++)
+		fprintf(stream, "%s time: %.6f s\n", phases[phase],
+			graph_stats.phase_time[phase]);
+}
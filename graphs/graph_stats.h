@@ -0,0 +1,73 @@
+#ifndef GRAPH_STATS_H
+#define GRAPH_STATS_H
+
+#include <stddef.h>
+#include <stdio.h>
+
+/**
+* enum graph_phase_e - Enumerates the phases whose wall-clock time
+* graph_stats accumulates
+*
+* @GRAPH_PHASE_LOAD: Building a graph from an edge list or file
+* @GRAPH_PHASE_FREEZE: Building or mapping a CSR snapshot
+* @GRAPH_PHASE_TRAVERSE: Traversals and component searches
+* @GRAPH_PHASE_SEARCH: Path searches
+* @GRAPH_NB_PHASES: Number of phases
+*/
+typedef enum graph_phase_e
+{
+	GRAPH_PHASE_LOAD = 0,
+	GRAPH_PHASE_FREEZE,
+	GRAPH_PHASE_TRAVERSE,
+	GRAPH_PHASE_SEARCH,
+	GRAPH_NB_PHASES
+} graph_phase_t;
+
+/**
+ * struct graph_stats_s - Counters filled in by the traversals and searches
+ * when built with -DGRAPH_STATS, accumulated until graph_stats_reset
+ *
+ * @vertices_visited: Vertices visited, or settled by a path search
+ * @edges_scanned: Edges looked at
+ * @peak_frontier: Largest queue, stack, frontier or heap seen
+ * @bytes_allocated: Bytes allocated for graphs, snapshots and scratch
+ * @phase_time: Seconds spent in each phase
+ */
+typedef struct graph_stats_s
+{
+	size_t vertices_visited;
+	size_t edges_scanned;
+	size_t peak_frontier;
+	size_t bytes_allocated;
+	double phase_time[GRAPH_NB_PHASES];
+} graph_stats_t;
+
+extern graph_stats_t graph_stats;
+extern __thread double graph_stats_start[GRAPH_NB_PHASES];
+
+void graph_stats_reset(void);
+double graph_stats_now(void);
+void graph_stats_print(FILE *stream);
+void graph_stats_peak(size_t n);
+void graph_stats_end(graph_phase_t phase);
+
+/*
+ * The counters are only updated when built with -DGRAPH_STATS; otherwise
+ * every hook below compiles to nothing. Readers of a shared snapshot and
+ * the workers of the parallel searches update them at the same time, so
+ * every update is atomic and each thread keeps its own phase start times
+ */
+#ifdef GRAPH_STATS
+#define STATS_ADD(field, n) \
+	((void)__sync_fetch_and_add(&graph_stats.field, (n)))
+#define STATS_PEAK(n) graph_stats_peak(n)
+#define STATS_BEGIN(phase) (graph_stats_start[phase] = graph_stats_now())
+#define STATS_END(phase) graph_stats_end(phase)
+#else
+#define STATS_ADD(field, n) ((void)0)
+#define STATS_PEAK(n) ((void)0)
+#define STATS_BEGIN(phase) ((void)0)
+#define STATS_END(phase) ((void)0)
+#endif
+
+#endif /*GRAPH_STATS_H*/
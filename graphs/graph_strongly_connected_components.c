@@ -0,0 +1,133 @@
+#include "graphs.h"
+
+/**
+ * scc_finish - completes a vertex once all its edges have been followed:
+ * either it is the root of a component, which is then popped off @stack
+ * and numbered @*c, or it is left on @stack for its root to collect
+ * @v: the index of the finished vertex
+ * @rindex: the rindex array of Pearce's algorithm
+ * @is_root: bitset of the vertices still believed to be component roots
+ * @stack: the stack of vertices waiting for their component
+ * @top: a pointer to the number of vertices on @stack
+ * @index: a pointer to the next rindex to hand out
+ * @c: a pointer to the rindex of the next component
+ */
+
+static void scc_finish(size_t v, size_t *rindex, unsigned char *is_root,
+		       size_t *stack, size_t *top, size_t *index, size_t *c)
+{
+	if (!BITSET_TEST(is_root, v))
+	{
+		stack[(*top)++] = v;
+		return;
+	}
+
+	(*index)--;
+	while (*top > 0 && rindex[v] <= rindex[stack[*top - 1]])
+	{
+		rindex[stack[--(*top)]] = *c;
+		(*index)--;
+	}
+	rindex[v] = (*c)--;
+}
+
+/**
+ * scc_visit - iterative depth-first search of Pearce's algorithm from a
+ * vertex not visited yet, using an explicit stack of (vertex, next edge)
+ * @root: the vertex to start from
+ * @rindex: the rindex array of Pearce's algorithm
+ * @is_root: bitset of the vertices still believed to be component roots
+ * @calls: explicit call stack of nb_vertices frames
+ * @stack: the stack of vertices waiting for their component
+ * @state: the stack size, next rindex and next component rindex
+ */
+
+static void scc_visit(const vertex_t *root, size_t *rindex,
+		      unsigned char *is_root, dfs_frame_t *calls,
+		      size_t *stack, size_t *state)
+{
+	size_t depth = 0, v, w;
+	const vertex_t *vertex;
+
+	calls[0].vertex = root, calls[0].edge = root->edges;
+	rindex[root->index] = state[1]++, BITSET_SET(is_root, root->index);
+	STATS_ADD(vertices_visited, 1), STATS_PEAK(1);
+	while (1)
+	{
+		v = calls[depth].vertex->index;
+		if (calls[depth].edge)
+		{
+			w = calls[depth].edge->dest->index;
+			STATS_ADD(edges_scanned, 1);
+			if (rindex[w] == 0)
+			{
+				vertex = calls[depth].edge->dest;
+				calls[++depth].vertex = vertex;
+				calls[depth].edge = vertex->edges;
+				rindex[w] = state[1]++, BITSET_SET(is_root, w);
+				STATS_ADD(vertices_visited, 1);
+				STATS_PEAK(depth + 1);
+				continue;
+			}
+			calls[depth].edge = calls[depth].edge->next;
+		}
+		else
+		{
+			scc_finish(v, rindex, is_root, stack, state, state + 1,
+				   state + 2);
+			if (depth-- == 0)
+				return;
+			w = v, v = calls[depth].vertex->index;
+			calls[depth].edge = calls[depth].edge->next;
+		}
+		if (rindex[w] < rindex[v])
+			rindex[v] = rindex[w], BITSET_CLEAR(is_root, v);
+	}
+}
+
+/**
+ * graph_strongly_connected_components - finds the strongly connected
+ * components of a graph with Pearce's iterative variant of Tarjan's
+ * algorithm, using O(V) extra memory in flat index arrays
+ * @graph: the graph
+ * @nb_components: a pointer set to the number of components, may be NULL
+ * Return: an array giving the component of each vertex index, components
+ * being numbered from 0 in reverse topological order (a component only has
+ * edges to components of lower number), to be freed by the caller; NULL on
+ * failure
+ */
+
+size_t *graph_strongly_connected_components(const graph_t *graph,
+					    size_t *nb_components)
+{
+	size_t *rindex, *stack, state[3], n, v;
+	unsigned char *is_root;
+	dfs_frame_t *calls;
+	vertex_t *vertex;
+
+	if (!graph || graph->nb_vertices == 0)
+		return (NULL);
+	n = graph->nb_vertices;
+	rindex = calloc(n, sizeof(size_t)), stack = malloc(n * sizeof(size_t));
+	is_root = calloc((n + 7) / 8, 1), calls = malloc(n * sizeof(*calls));
+	if (rindex && stack && is_root && calls)
+	{
+		STATS_BEGIN(GRAPH_PHASE_TRAVERSE);
+		STATS_ADD(bytes_allocated, n * (2 * sizeof(size_t) +
+					       sizeof(*calls)) + (n + 7) / 8);
+		state[0] = 0, state[1] = 1, state[2] = n - 1;
+		for (vertex = graph->vertices; vertex; vertex = vertex->next)
+			if (rindex[vertex->index] == 0)
+				scc_visit(vertex, rindex, is_root, calls, stack,
+					  state);
+		for (v = 0; v < n; v++)
+			rindex[v] = n - 1 - rindex[v];
+		if (nb_components)
+			*nb_components = n - 1 - state[2];
+		STATS_END(GRAPH_PHASE_TRAVERSE);
+	}
+	else
+		free(rindex), rindex = NULL;
+	free(stack), free(is_root), free(calls);
+	return (rindex);
+}
@@ -0,0 +1,147 @@
+#include "graphs.h"
+
+/**
+ * traversal_begin - starts a resumable traversal of a graph, nothing being
+ * visited until the first call to traversal_next
+ * @graph: the graph to traverse, not to be modified until traversal_end
+ * @mode: TRAVERSAL_DFS or TRAVERSAL_BFS
+ * Return: the traversal, to be released with traversal_end, or NULL on
+ * failure
+ */
+
+graph_traversal_t *traversal_begin(const graph_t *graph,
+				   traversal_mode_t mode)
+{
+	graph_traversal_t *it;
+
+	if (!graph)
+		return (NULL);
+	it = calloc(1, sizeof(*it));
+	if (!it)
+		return (NULL);
+	it->graph = graph, it->mode = mode, it->root = graph->vertices;
+	it->visited = calloc((graph->nb_vertices + 7) / 8 + 1, 1);
+	if (mode == TRAVERSAL_DFS)
+	{
+		it->size = DFS_STACK_MIN_SIZE;
+		it->stack = malloc(it->size * sizeof(dfs_frame_t));
+	}
+	else
+	{
+		it->queue = queue_create(), it->level_size = 1;
+		if (it->queue && it->visited && graph->vertices &&
+		    queue_push_back(it->queue, graph->vertices))
+			BITSET_SET(it->visited, graph->vertices->index);
+	}
+	if (!it->visited || (!it->stack && !it->queue))
+	{
+		traversal_end(it);
+		return (NULL);
+	}
+	return (it);
+}
+
+/**
+ * dfs_visit - marks a vertex visited and pushes it on the traversal stack,
+ * doubling the stack when it is full
+ * @it: the traversal
+ * @vertex: the vertex to visit
+ * Return: the vertex, or NULL on failure, which is flagged in @it
+ */
+
+static const vertex_t *dfs_visit(graph_traversal_t *it,
+				 const vertex_t *vertex)
+{
+	dfs_frame_t *grown;
+
+	if (it->top == it->size)
+	{
+		grown = realloc(it->stack, it->size * 2 * sizeof(dfs_frame_t));
+		if (!grown)
+			return (it->failed = 1, NULL);
+		STATS_ADD(bytes_allocated, it->size * sizeof(dfs_frame_t));
+		it->stack = grown;
+		it->size *= 2;
+	}
+	STATS_ADD(vertices_visited, 1), STATS_PEAK(it->top + 1);
+	BITSET_SET(it->visited, vertex->index);
+	it->stack[it->top].vertex = vertex;
+	it->stack[it->top++].edge = vertex->edges;
+	return (vertex);
+}
+
+/**
+ * dfs_next - resumes the depth-first search up to its next vertex
+ * @it: the traversal
+ * @depth: a pointer set to the depth of the vertex
+ * Return: the next vertex, or NULL once the whole graph has been visited
+ */
+
+static const vertex_t *dfs_next(graph_traversal_t *it, size_t *depth)
+{
+	dfs_frame_t *frame;
+	const vertex_t *dest;
+
+	while (it->top > 0)
+	{
+		frame = it->stack + it->top - 1;
+		if (!frame->edge)
+		{
+			it->top--;
+			continue;
+		}
+		dest = frame->edge->dest;
+		frame->edge = frame->edge->next;
+		STATS_ADD(edges_scanned, 1);
+		if (BITSET_TEST(it->visited, dest->index))
+			continue;
+		*depth = it->top;
+		return (dfs_visit(it, dest));
+	}
+	while (it->root && BITSET_TEST(it->visited, it->root->index))
+		it->root = it->root->next;
+	if (!it->root)
+		return (NULL);
+	*depth = 0;
+	return (dfs_visit(it, it->root));
+}
+
+/**
+ * traversal_next - resumes a traversal up to its next vertex
+ * @it: the traversal
+ * @depth: a pointer set to the depth of the vertex, may be NULL
+ * Return: the next vertex, or NULL once the traversal is over or on failure,
+ * which traversal_failed tells apart
+ */
+
+const vertex_t *traversal_next(graph_traversal_t *it, size_t *depth)
+{
+	const vertex_t *curr;
+	size_t unused;
+	edge_t *edge;
+
+	if (!it || it->failed)
+		return (NULL);
+	if (!depth)
+		depth = &unused;
+	if (it->mode == TRAVERSAL_DFS)
+		return (dfs_next(it, depth));
+	curr = queue_pop_front(it->queue);
+	if (!curr)
+		return (NULL);
+	if (it->level_size-- == 0)
+		it->depth++, it->level_size = it->queue->size;
+	STATS_ADD(vertices_visited, 1);
+	STATS_ADD(edges_scanned, curr->nb_edges);
+	for (edge = curr->edges; edge; edge = edge->next)
+	{
+		if (BITSET_TEST(it->visited, edge->dest->index))
+			continue;
+		if (!queue_push_back(it->queue, edge->dest))
+			return (it->failed = 1, NULL);
+		BITSET_SET(it->visited, edge->dest->index);
+	}
+	STATS_PEAK(it->queue->size);
+	*depth = it->depth;
+	return (curr);
+}
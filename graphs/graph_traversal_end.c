@@ -0,0 +1,29 @@
+#include "graphs.h"
+
+/**
+ * traversal_failed - tells whether a traversal stopped because its stack
+ * or its queue failed to grow, rather than because it visited everything
+ * it could
+ * @it: the traversal
+ * Return: 1 if traversal_next failed, 0 otherwise
+ */
+
+int traversal_failed(const graph_traversal_t *it)
+{
+	return (it && it->failed);
+}
+
+/**
+ * traversal_end - releases a traversal, finished or not
+ * @it: the traversal, may be NULL
+ */
+
+void traversal_end(graph_traversal_t *it)
+{
+	if (!it)
+		return;
+	free(it->visited);
+	free(it->stack);
+	queue_delete(it->queue);
+	free(it);
+}
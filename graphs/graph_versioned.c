@@ -0,0 +1,128 @@
+#include "graphs.h"
+#include <sched.h>
+
+/**
+ * versioned_reclaim - frees the retired snapshots no reader can still be
+ * traversing: those replaced before the oldest epoch a reader is pinned in
+ * @vgraph: the versioned graph, its lock held
+ */
+
+static void versioned_reclaim(graph_versioned_t *vgraph)
+{
+	size_t oldest = (size_t)-1, pinned;
+	graph_retired_t **link = &vgraph->retired, *retired;
+	graph_reader_t *reader;
+
+	for (reader = vgraph->readers; reader; reader = reader->next)
+	{
+		pinned = __atomic_load_n(&reader->pinned, __ATOMIC_SEQ_CST);
+		if (pinned && pinned < oldest)
+			oldest = pinned;
+	}
+	while ((retired = *link))
+	{
+		if (retired->epoch < oldest)
+		{
+			*link = retired->next;
+			graph_csr_delete(retired->csr);
+			free(retired);
+		}
+		else
+			link = &retired->next;
+	}
+}
+
+/**
+ * graph_versioned_publish - freezes the graph as it stands and makes the
+ * new snapshot the one readers get, retiring the previous one
+ * Writers may batch many changes before publishing, each publication
+ * costing a graph_freeze
+ * @vgraph: the versioned graph
+ * Return: 1 on success, 0 on failure, the previous snapshot staying current
+ */
+
+int graph_versioned_publish(graph_versioned_t *vgraph)
+{
+	graph_retired_t *retired;
+	graph_csr_t *csr;
+	int ok = 0;
+
+	pthread_mutex_lock(&vgraph->lock);
+	csr = graph_freeze(vgraph->graph);
+	retired = malloc(sizeof(*retired));
+	if (csr && retired)
+	{
+		retired->csr = __atomic_exchange_n(&vgraph->current, csr,
+						   __ATOMIC_SEQ_CST);
+		retired->epoch = __atomic_fetch_add(&vgraph->epoch, 1,
+						    __ATOMIC_SEQ_CST);
+		retired->next = vgraph->retired;
+		vgraph->retired = retired;
+		vgraph->version++;
+		versioned_reclaim(vgraph);
+		ok = 1;
+	}
+	else
+		graph_csr_delete(csr), free(retired);
+	pthread_mutex_unlock(&vgraph->lock);
+	return (ok);
+}
+
+/**
+ * graph_versioned_create - wraps a graph for concurrent readers, publishing
+ * its first snapshot
+ * @graph: the graph, owned by the versioned graph from now on
+ * Return: the versioned graph, or NULL on failure, @graph being left to
+ * the caller
+ */
+
+graph_versioned_t *graph_versioned_create(graph_t *graph)
+{
+	graph_versioned_t *vgraph;
+
+	if (!graph)
+		return (NULL);
+	vgraph = calloc(1, sizeof(*vgraph));
+	if (!vgraph)
+		return (NULL);
+	vgraph->graph = graph;
+	vgraph->epoch = 1;
+	vgraph->current = graph_freeze(graph);
+	if (!vgraph->current)
+	{
+		free(vgraph);
+		return (NULL);
+	}
+	pthread_mutex_init(&vgraph->lock, NULL);
+	return (vgraph);
+}
+
+/**
+ * graph_versioned_delete - frees a versioned graph, its graph, its reader
+ * slots and every snapshot, waiting for the readers still in a read
+ * section to leave it; no reader may start one anymore
+ * @vgraph: the versioned graph, may be NULL
+ */
+
+void graph_versioned_delete(graph_versioned_t *vgraph)
+{
+	graph_reader_t *reader, *next;
+
+	if (!vgraph)
+		return;
+	pthread_mutex_lock(&vgraph->lock);
+	for (reader = vgraph->readers; reader; reader = reader->next)
+		while (__atomic_load_n(&reader->pinned, __ATOMIC_SEQ_CST))
+			sched_yield();
+	versioned_reclaim(vgraph);
+	pthread_mutex_unlock(&vgraph->lock);
+	for (reader = vgraph->readers; reader; reader = next)
+	{
+		next = reader->next;
+		free(reader);
+	}
+	graph_csr_delete(vgraph->current);
+	graph_delete(vgraph->graph);
+	pthread_mutex_destroy(&vgraph->lock);
+	free(vgraph);
+}
@@ -0,0 +1,82 @@
+#include "graphs.h"
+
+/**
+ * graph_reader_register - gets a reader slot for a thread that will read a
+ * versioned graph, reusing a released one if any
+ * @vgraph: the versioned graph
+ * Return: the slot, to be used by one thread at a time, or NULL on failure
+ */
+
+graph_reader_t *graph_reader_register(graph_versioned_t *vgraph)
+{
+	graph_reader_t *reader;
+
+	if (!vgraph)
+		return (NULL);
+	pthread_mutex_lock(&vgraph->lock);
+	for (reader = vgraph->readers; reader; reader = reader->next)
+		if (!__atomic_load_n(&reader->in_use, __ATOMIC_ACQUIRE))
+			break;
+	if (!reader)
+	{
+		reader = calloc(1, sizeof(*reader));
+		if (reader)
+		{
+			reader->next = vgraph->readers;
+			vgraph->readers = reader;
+		}
+	}
+	if (reader)
+		reader->in_use = 1;
+	pthread_mutex_unlock(&vgraph->lock);
+	return (reader);
+}
+
+/**
+ * graph_reader_release - gives a reader slot back, outside a read section
+ * @reader: the slot, may be NULL
+ */
+
+void graph_reader_release(graph_reader_t *reader)
+{
+	if (!reader)
+		return;
+	__atomic_store_n(&reader->in_use, 0, __ATOMIC_RELEASE);
+}
+
+/**
+ * graph_read_begin - enters a read section, pinning the current epoch
+ * The epoch is read again once pinned: if a writer moved it meanwhile, it
+ * may have missed the pin while reclaiming, so the pin is taken again.
+ * Never blocks
+ * @vgraph: the versioned graph
+ * @reader: the reader slot of the calling thread, outside a read section
+ * Return: the latest snapshot, which stays valid and unchanged until
+ * graph_read_end, or NULL on invalid arguments
+ */
+
+const graph_csr_t *graph_read_begin(graph_versioned_t *vgraph,
+				    graph_reader_t *reader)
+{
+	size_t epoch;
+
+	if (!vgraph || !reader)
+		return (NULL);
+	do {
+		epoch = __atomic_load_n(&vgraph->epoch, __ATOMIC_SEQ_CST);
+		__atomic_store_n(&reader->pinned, epoch, __ATOMIC_SEQ_CST);
+	} while (epoch != __atomic_load_n(&vgraph->epoch, __ATOMIC_SEQ_CST));
+	return (__atomic_load_n(&vgraph->current, __ATOMIC_SEQ_CST));
+}
+
+/**
+ * graph_read_end - leaves a read section, after which the snapshot it
+ * returned must not be used anymore
+ * @reader: the reader slot
+ */
+
+void graph_read_end(graph_reader_t *reader)
+{
+	if (reader)
+		__atomic_store_n(&reader->pinned, 0, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,68 @@
+#include "graphs.h"
+
+/**
+ * graph_versioned_add_vertex - adds a vertex to a versioned graph; readers
+ * see it from the next graph_versioned_publish on
+ * @vgraph: the versioned graph
+ * @str: the content of the vertex
+ * Return: as graph_add_vertex
+ */
+
+vertex_t *graph_versioned_add_vertex(graph_versioned_t *vgraph,
+				     const char *str)
+{
+	vertex_t *vertex;
+
+	if (!vgraph)
+		return (NULL);
+	pthread_mutex_lock(&vgraph->lock);
+	vertex = graph_add_vertex(vgraph->graph, str);
+	pthread_mutex_unlock(&vgraph->lock);
+	return (vertex);
+}
+
+/**
+ * graph_versioned_add_edge - adds an edge to a versioned graph; readers
+ * see it from the next graph_versioned_publish on
+ * @vgraph: the versioned graph
+ * @src: the content of the source vertex
+ * @dest: the content of the destination vertex
+ * @type: UNIDIRECTIONAL or BIDIRECTIONAL
+ * Return: as graph_add_edge
+ */
+
+int graph_versioned_add_edge(graph_versioned_t *vgraph, const char *src,
+			     const char *dest, edge_type_t type)
+{
+	int ok;
+
+	if (!vgraph)
+		return (0);
+	pthread_mutex_lock(&vgraph->lock);
+	ok = graph_add_edge(vgraph->graph, src, dest, type);
+	pthread_mutex_unlock(&vgraph->lock);
+	return (ok);
+}
+
+/**
+ * graph_versioned_remove_edge - removes an edge from a versioned graph;
+ * readers stop seeing it from the next graph_versioned_publish on, the
+ * snapshots still holding it being reclaimed by epochs
+ * @vgraph: the versioned graph
+ * @src: the content of the source vertex
+ * @dest: the content of the destination vertex
+ * Return: as graph_remove_edge
+ */
+
+int graph_versioned_remove_edge(graph_versioned_t *vgraph, const char *src,
+				const char *dest)
+{
+	int ok;
+
+	if (!vgraph)
+		return (0);
+	pthread_mutex_lock(&vgraph->lock);
+	ok = graph_remove_edge(vgraph->graph, src, dest);
+	pthread_mutex_unlock(&vgraph->lock);
+	return (ok);
+}
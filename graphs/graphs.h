@@ -4,13 +4,51 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <pthread.h>
+#include "graph_stats.h"
+#include "graph_csr.h"
 
 
 #define  UNEXPLORED 0
 #define  EXPLORED 1
 #define BACKTRACK 2
-#define SIZE 65536
-#define LEVELBREAK -60
+#define QUEUE_MIN_SIZE 16
+#define GRAPH_INDEX_MIN_SIZE 16
+#define DFS_STACK_MIN_SIZE 64
+#define DFS_FAILED ((size_t)-1)
+#define BITSET_TEST(set, i) ((set)[(i) >> 3] & (1 << ((i) & 7)))
+#define BITSET_SET(set, i) ((set)[(i) >> 3] |= (1 << ((i) & 7)))
+#define BITSET_CLEAR(set, i) ((set)[(i) >> 3] &= ~(1 << ((i) & 7)))
+#define WORD_BITS (sizeof(unsigned long) * 8)
+#define BITMAP_WORDS(n) (((n) + WORD_BITS - 1) / WORD_BITS)
+#define BITMAP_TEST(map, i) (((map)[(i) / WORD_BITS] >> ((i) % WORD_BITS)) & 1)
+#define BITMAP_SET(map, i) ((map)[(i) / WORD_BITS] |= 1UL << ((i) % WORD_BITS))
+#define DOBFS_ALPHA 14
+#define DOBFS_BETA 24
+#define PBFS_CHUNK 64
+#define PBFS_LOCAL_SIZE 4096
+#define PBFS_UNVISITED ((size_t)-1)
+#define CC_CHUNK 1024
+#define GRAPH_ARENA 1
+#define GRAPH_UNIQUE_EDGES 2
+#define EDGE_HASH(src, dest) \
+	((((size_t)(src) >> 4) * 31 + ((size_t)(dest) >> 4)) * 2654435761UL)
+#define GRAPH_SLAB_MIN_SIZE 65536
+#define GRAPH_SLAB_MAX_SIZE 67108864
+#define GRAPH_LOAD_BLOCK_MIN 64
+#define GRAPH_LABEL_INLINE 16
+#define GRAPH_LABELS_MIN_SIZE 4096
+#define VARINT_MAX_SIZE 10
+#define VARINT_GET(p, value) \
+	((value) = *(p) < 0x80 ? *(p)++ : graph_varint_get(&(p)))
+#define PACKED_FIRST(v, z) ((z) & 1 ? (v) - ((z) >> 1) - 1 : (v) + ((z) >> 1))
+#define PACKED_MAX_VERTICES 0x7fffffffUL
+#define PACKED_PADDING 3
+#define PACKED_PREFETCH 8
+#define PACKED_CODE(ctrl, k) (((ctrl)[(k) >> 2] >> (((k) & 3) << 1)) & 3)
+#define PACKED_LOAD(d, code) \
+	(((size_t)(d)[0] | (size_t)(d)[1] << 8 | (size_t)(d)[2] << 16 | \
+	  (size_t)(d)[3] << 24) & (0xffffffffUL >> ((3 - (code)) << 3)))
 
 /**
 * enum edge_type_e - Enumerates the different types of
@@ -25,6 +63,21 @@ typedef enum edge_type_e
 	BIDIRECTIONAL
 } edge_type_t;
 
+/**
+* enum graph_order_e - Enumerates the vertex orders graph_reorder can
+* renumber a graph by
+*
+* @GRAPH_ORDER_RCM: Reverse Cuthill-McKee, keeps neighbours close together
+* @GRAPH_ORDER_DEGREE: Descending out-degree, packs the hubs together
+* @GRAPH_ORDER_BFS: Breadth-first discovery order
+*/
+typedef enum graph_order_e
+{
+	GRAPH_ORDER_RCM = 0,
+	GRAPH_ORDER_DEGREE,
+	GRAPH_ORDER_BFS
+} graph_order_t;
+
 /* Define the structure temporarily for usage in the edge_t */
 
 typedef struct vertex_s vertex_t;
@@ -47,36 +100,296 @@ typedef struct edge_s
 * struct vertex_s - Node in the linked list of vertices in the adjacency list
 *
 * @index: Index of the vertex in the adjacency list.
-* @content: Custom data stored in the vertex (here, a string)
+* @content: Custom data stored in the vertex (here, a string), pointing
+*   to @label when it fits there and into the label pool of the graph
+*   otherwise
+* @hash: Hash of @content, as computed by graph_hash
+* @length: Length of @content
 * @nb_edges: Number of connections with other vertices in the graph
 * @edges: Pointer to the head node of the linked list of edges
+* @edges_tail: Pointer to the last node of the linked list of edges
 * @next: Pointer to the next vertex in the adjacency linked list
 *   This pointer points to another vertex in the graph, but it
 *   doesn't stand for an edge between the two vertices
+* @label: Inline storage of the contents shorter than GRAPH_LABEL_INLINE
 */
 struct vertex_s
 {
 	size_t      index;
 	char        *content;
+	size_t      hash;
+	size_t      length;
 
 	size_t      nb_edges;
 	edge_t      *edges;
+	edge_t      *edges_tail;
 	struct vertex_s *next;
+	char        label[GRAPH_LABEL_INLINE];
 };
 
+/**
+* struct edge_key_s - Entry of the edge set of a graph
+*
+* @src: Pointer to the source vertex of the edge, NULL for an empty slot
+* @dest: Pointer to the destination vertex of the edge
+*/
+typedef struct edge_key_s
+{
+	const vertex_t *src;
+	const vertex_t *dest;
+} edge_key_t;
+
+/**
+* struct graph_slab_s - Header of a slab of memory owned by a graph arena
+* The usable bytes of the slab directly follow this header
+*
+* @next: Pointer to the slab filled before this one
+* @size: Number of usable bytes in the slab
+* @used: Number of bytes already handed out from the slab
+*/
+typedef struct graph_slab_s
+{
+	struct graph_slab_s *next;
+	size_t      size;
+	size_t      used;
+} graph_slab_t;
+
 /**
 * struct graph_s - Representation of a graph
 * We use an adjacency linked list to represent our graph
 *
 * @nb_vertices: Number of vertices in our graph
 * @vertices: Pointer to the head node of our adjacency linked list
+* @tail: Pointer to the last vertex of our adjacency linked list
+* @index: Open-addressing hash table mapping a vertex content to its vertex
+* @index_size: Number of slots in @index (zero or a power of two)
+* @flags: GRAPH_ARENA if vertices and edges live in @slabs,
+*   GRAPH_UNIQUE_EDGES if duplicate edges are rejected
+* @edge_set: Open-addressing hash set of the edges of the graph, only kept
+*   in GRAPH_UNIQUE_EDGES mode
+* @edge_set_size: Number of slots in @edge_set (zero or a power of two)
+* @nb_edge_keys: Number of edges in @edge_set
+* @slabs: Pointer to the slab vertices and edges are bumped from, in arena
+*   mode, or to the last block graph_alloc_block carved some from otherwise
+* @labels: Blocks of the label pool, holding the contents too long to be
+*   stored inline in their vertex
 */
 typedef struct graph_s
 {
 	size_t      nb_vertices;
 	vertex_t    *vertices;
+	vertex_t    *tail;
+	vertex_t    **index;
+	size_t      index_size;
+	int         flags;
+	graph_slab_t *slabs;
+	edge_key_t  *edge_set;
+	size_t      edge_set_size;
+	size_t      nb_edge_keys;
+	graph_slab_t *labels;
 } graph_t;
 
+/**
+* struct dfs_frame_s - Frame of the explicit stack of depth_first_traverse
+*
+* @vertex: Pointer to the vertex being explored
+* @edge: Pointer to the next edge of @vertex to follow
+*/
+typedef struct dfs_frame_s
+{
+	const vertex_t *vertex;
+	const edge_t *edge;
+} dfs_frame_t;
+
+/**
+* struct graph_packed_s - Read-only snapshot of a graph whose adjacency is
+* delta-compressed, in the layout of StreamVByte
+* The neighbours of each vertex are sorted by index; the first one is
+* stored as the zigzag-encoded difference with the vertex and every next
+* one as the gap with the previous one. A vertex with n neighbours takes
+* n as a varint (7 bits per byte, low-order bits first, the high bit of
+* every byte but the last being set), then (n + 3) / 4 control bytes
+* holding 2 bits per number, its size in bytes minus one, then the n
+* numbers in little-endian order. Decoding a number is a branch-free
+* 4-byte load and mask, which is why @bytes is followed by
+* PACKED_PADDING zero bytes
+*
+* @nb_vertices: Number of vertices in the snapshot
+* @nb_edges: Number of edges in the snapshot
+* @offsets: Position of the neighbours of each vertex in @bytes, with a
+*   trailing entry equal to @size
+* @bytes: Encoded neighbours of all the vertices
+* @size: Size of @bytes, padding excluded
+* @max_degree: Largest number of neighbours of a vertex
+* @label_offsets: Position of the content of each vertex in @labels
+* @labels: Contents of all the vertices, each one NUL-terminated
+*/
+typedef struct graph_packed_s
+{
+	size_t      nb_vertices;
+	size_t      nb_edges;
+	size_t      *offsets;
+	unsigned char *bytes;
+	size_t      size;
+	size_t      max_degree;
+	size_t      *label_offsets;
+	char        *labels;
+} graph_packed_t;
+
+/**
+* struct packed_cursor_s - Position in the neighbours of a vertex of a
+* delta-compressed snapshot, for the traversals that decode them one by one
+*
+* @ctrl: Control bytes of the neighbours
+* @data: Encoding of the next neighbour
+* @index: Number of neighbours already decoded
+* @count: Number of neighbours of the vertex
+* @last: Last neighbour decoded, or the vertex itself before the first
+*/
+typedef struct packed_cursor_s
+{
+	const unsigned char *ctrl;
+	const unsigned char *data;
+	size_t      index;
+	size_t      count;
+	size_t      last;
+} packed_cursor_t;
+
+/**
+* struct bfs_frontier_s - One level of a direction-optimizing BFS, kept both
+* as a list (for top-down steps) and as a bitmap (for bottom-up steps)
+*
+* @list: Indices of the vertices of the level
+* @size: Number of vertices in @list
+* @bits: Bitmap of the vertices of the level
+*/
+typedef struct bfs_frontier_s
+{
+	size_t      *list;
+	size_t      size;
+	unsigned long *bits;
+} bfs_frontier_t;
+
+/**
+* struct pbfs_shared_s - State shared by the workers of a parallel BFS
+*
+* @csr: Snapshot being traversed
+* @levels: Level of each vertex, PBFS_UNVISITED until it is claimed
+* @parents: Vertex each vertex was discovered from
+* @frontier: Vertices of the current level
+* @frontier_size: Number of vertices in @frontier
+* @next: Vertices of the next level, filled concurrently
+* @next_size: Number of vertices in @next
+* @cursor: Position of the next chunk of @frontier to hand out
+* @depth: Level being built
+* @start: Mutex held while the workers are being spawned
+* @barrier: Barrier the workers meet at between two levels
+*/
+typedef struct pbfs_shared_s
+{
+	const graph_csr_t *csr;
+	size_t      *levels;
+	size_t      *parents;
+	size_t      *frontier;
+	size_t      frontier_size;
+	size_t      *next;
+	size_t      next_size;
+	size_t      cursor;
+	size_t      depth;
+	pthread_mutex_t start;
+	pthread_barrier_t barrier;
+} pbfs_shared_t;
+
+/**
+* struct pbfs_worker_s - Private state of a worker of a parallel BFS
+*
+* @shared: State shared by all the workers
+* @id: Position of the worker, the worker 0 swaps the levels
+* @local: Buffer of the vertices discovered by this worker
+* @local_size: Number of vertices in @local
+* @thread: Thread running the worker
+*/
+typedef struct pbfs_worker_s
+{
+	pbfs_shared_t *shared;
+	size_t      id;
+	size_t      *local;
+	size_t      local_size;
+	pthread_t   thread;
+} pbfs_worker_t;
+
+/**
+* struct cc_shared_s - State shared by the threads labelling the connected
+* components of a snapshot
+*
+* @csr: Snapshot being labelled
+* @parent: Union-find forest, each vertex pointing to a vertex of its
+*   component of lower or equal index
+* @cursor: First vertex of the next chunk to hand out
+* @phase: 0 while the edges are being merged, 1 while the forest is being
+*   flattened
+*/
+typedef struct cc_shared_s
+{
+	const graph_csr_t *csr;
+	size_t      *parent;
+	size_t      cursor;
+	int         phase;
+} cc_shared_t;
+
+/**
+ * struct graph_reader_s - Reader slot of a versioned graph
+ *
+ * @pinned: Epoch the reader entered its read section in, 0 outside
+ * @in_use: Nonzero while the slot belongs to a reader
+ * @next: Next slot, slots are never freed before the graph
+ */
+typedef struct graph_reader_s
+{
+	size_t      pinned;
+	int         in_use;
+	struct graph_reader_s *next;
+} graph_reader_t;
+
+/**
+ * struct graph_retired_s - Snapshot replaced by a newer one, freed once no
+ * reader pinned in an epoch up to @epoch is left
+ *
+ * @csr: The snapshot
+ * @epoch: Epoch the snapshot was replaced in
+ * @next: Next retired snapshot
+ */
+typedef struct graph_retired_s
+{
+	graph_csr_t *csr;
+	size_t      epoch;
+	struct graph_retired_s *next;
+} graph_retired_t;
+
+/**
+ * struct graph_versioned_s - Graph mutated by writers while readers
+ * traverse immutable CSR snapshots of it, published through @current and
+ * reclaimed by epochs, so that readers never take a lock
+ *
+ * @graph: The graph the writers mutate, under @lock
+ * @current: Latest published snapshot
+ * @epoch: Global epoch, advanced at every publication
+ * @version: Number of snapshots published
+ * @readers: Reader slots
+ * @retired: Replaced snapshots not yet freed
+ * @lock: Serializes the writers and the registration of readers
+ */
+typedef struct graph_versioned_s
+{
+	graph_t     *graph;
+	graph_csr_t *current;
+	size_t      epoch;
+	size_t      version;
+	graph_reader_t *readers;
+	graph_retired_t *retired;
+	pthread_mutex_t lock;
+} graph_versioned_t;
+
 /**
 * struct queue_node_s - queue node data structure
 * @vertex: pointer to vertex type
@@ -100,37 +413,171 @@ typedef struct queue_node_s
 */
 
 /**
- * struct queue_s - Representation of a queue
+ * struct queue_s - Growable ring buffer of vertices
  *
- * @items: items to be queued
- * @front: Pointer to the first item in queue
- * @rear: Pointer to the last item in queue
+ * @items: Ring buffer of the vertices in the queue
+ * @capacity: Number of slots in @items (a power of two)
+ * @front: Position of the first vertex of the queue in @items
+ * @size: Number of vertices in the queue
  */
 typedef struct queue_s
 {
-	int items[SIZE];
-	int front;
-	int rear;
-
+	const vertex_t **items;
+	size_t capacity;
+	size_t front;
+	size_t size;
 } queue_t;
 
+/**
+* enum traversal_mode_e - Enumerates the orders a graph_traversal_t can
+* walk a graph in
+*
+* @TRAVERSAL_DFS: Depth-first, restarting from every unreached vertex
+* @TRAVERSAL_BFS: Breadth-first, from the first vertex
+*/
+typedef enum traversal_mode_e
+{
+	TRAVERSAL_DFS = 0,
+	TRAVERSAL_BFS
+} traversal_mode_t;
+
+/**
+ * struct graph_traversal_s - Resumable traversal of a graph, yielding one
+ * vertex per call to traversal_next in the order the matching callback
+ * traversal would visit it
+ *
+ * @graph: The graph being traversed
+ * @mode: The order of the traversal
+ * @visited: Bitset of the vertices already yielded or queued
+ * @stack: Explicit stack of the depth-first search
+ * @size: Number of frames @stack can hold
+ * @top: Number of frames on @stack
+ * @root: Next vertex to try as a depth-first root
+ * @queue: Queue of the breadth-first search
+ * @depth: Depth of the last vertex yielded by the breadth-first search
+ * @level_size: Vertices left to yield at @depth
+ * @failed: Set once the stack or the queue failed to grow, which ends the
+ *   traversal early
+ */
+typedef struct graph_traversal_s
+{
+	const graph_t *graph;
+	traversal_mode_t mode;
+	unsigned char *visited;
+	dfs_frame_t *stack;
+	size_t size;
+	size_t top;
+	const vertex_t *root;
+	queue_t *queue;
+	size_t depth;
+	size_t level_size;
+	int failed;
+} graph_traversal_t;
+
 
 queue_t *queue_create(void);
-void queue_push_front(queue_t *queue, vertex_t *vertex);
-void queue_push_back(queue_t *queue, vertex_t *vertex);
-vertex_t *queue_pop_front(queue_t *queue);
+int queue_push_back(queue_t *queue, const vertex_t *vertex);
+const vertex_t *queue_pop_front(queue_t *queue);
+void queue_delete(queue_t *queue);
 
 
 graph_t *graph_create(void);
+graph_t *graph_create_arena(void);
+void *graph_alloc(graph_t *graph, size_t size);
+void *graph_alloc_block(graph_t *graph, size_t size);
+void graph_free(graph_t *graph, void *ptr);
+void graph_arena_delete(graph_t *graph);
+char *graph_intern(graph_t *graph, const char *str, size_t length);
+void graph_labels_delete(graph_t *graph);
 vertex_t *graph_add_vertex(graph_t *graph, const char *str);
+int graph_vertex_init(graph_t *graph, vertex_t *vertex, const char *str,
+size_t hash, size_t length);
 
+edge_t *graph_add_single_edge(graph_t *graph, vertex_t *src_vertex,
+vertex_t *dest_vertex);
+void graph_link_edge(graph_t *graph, vertex_t *src_vertex, edge_t *edge);
+int graph_edge_is_duplicate(const graph_t *graph, const vertex_t *src_vertex,
+const vertex_t *dest_vertex, edge_type_t type);
 int graph_add_edge
 (graph_t *graph, const char *src, const char *dest, edge_type_t type);
 
 void graph_delete(graph_t *graph);
+int graph_remove_edge(graph_t *graph, const char *src, const char *dest);
+int graph_unique_edges(graph_t *graph);
+int graph_has_edge(const graph_t *graph, const char *src, const char *dest);
+const edge_key_t *graph_edge_set_find(const graph_t *graph,
+const vertex_t *src, const vertex_t *dest);
+int graph_edge_set_reserve(graph_t *graph);
+void graph_edge_set_insert(graph_t *graph, const vertex_t *src,
+const vertex_t *dest);
+int graph_load_edge_list(graph_t *graph, const char **pairs, size_t n,
+edge_type_t type);
+int graph_load_edge_file(graph_t *graph, const char *path, edge_type_t type);
+
+size_t graph_hash(const char *str, size_t *length);
+vertex_t **graph_index_slot(const graph_t *graph, const char *str,
+size_t hash, size_t length);
+vertex_t *graph_index_lookup(const graph_t *graph, const char *str,
+size_t hash, size_t length);
+vertex_t *graph_index_find(const graph_t *graph, const char *str);
+int graph_index_reserve(graph_t *graph, size_t count);
+int graph_index_insert(graph_t *graph, vertex_t *vertex);
+
 size_t depth_first_traverse(const graph_t *graph,
 void (*action)(const vertex_t *v, size_t depth));
 size_t breadth_first_traverse(const graph_t *graph,
 void (*action)(const vertex_t *v, size_t depth));
+graph_traversal_t *traversal_begin(const graph_t *graph,
+traversal_mode_t mode);
+const vertex_t *traversal_next(graph_traversal_t *it, size_t *depth);
+int traversal_failed(const graph_traversal_t *it);
+void traversal_end(graph_traversal_t *it);
+
+graph_csr_t *graph_csr_create(size_t nb_vertices, size_t nb_edges,
+size_t labels_size);
+int graph_csr_add_reverse(graph_csr_t *csr);
+size_t depth_first_traverse_csr(const graph_csr_t *csr,
+void (*action)(const graph_csr_t *csr, size_t v, size_t depth));
+size_t breadth_first_traverse_csr(const graph_csr_t *csr,
+void (*action)(const graph_csr_t *csr, size_t v, size_t depth));
+size_t breadth_first_traverse_csr_from(const graph_csr_t *csr, size_t source,
+void (*action)(const graph_csr_t *csr, size_t v, size_t depth));
+graph_packed_t *graph_csr_pack(const graph_csr_t *csr);
+void graph_packed_delete(graph_packed_t *packed);
+const char *graph_packed_label(const graph_packed_t *packed, size_t v);
+size_t graph_varint_put(unsigned char *out, size_t value);
+size_t graph_varint_get(const unsigned char **p);
+size_t depth_first_traverse_packed(const graph_packed_t *packed,
+void (*action)(const graph_packed_t *packed, size_t v, size_t depth));
+size_t breadth_first_traverse_packed(const graph_packed_t *packed,
+void (*action)(const graph_packed_t *packed, size_t v, size_t depth));
+size_t breadth_first_traverse_do(const graph_csr_t *csr,
+void (*action)(const graph_csr_t *csr, size_t v, size_t depth));
+size_t breadth_first_traverse_parallel(const graph_csr_t *csr,
+size_t nb_threads, size_t *levels, size_t *parents);
+size_t *breadth_first_traverse_multi(const graph_csr_t *csr,
+const size_t *sources, size_t nb_sources);
+size_t *graph_connected_components(const graph_csr_t *csr,
+size_t nb_threads);
+size_t *graph_strongly_connected_components(const graph_t *graph,
+size_t *nb_components);
+graph_t *graph_condense(const graph_t *graph);
+vertex_t **graph_order(const graph_t *graph, graph_order_t strategy);
+int graph_reorder(graph_t *graph, graph_order_t strategy);
+
+graph_versioned_t *graph_versioned_create(graph_t *graph);
+int graph_versioned_publish(graph_versioned_t *vgraph);
+void graph_versioned_delete(graph_versioned_t *vgraph);
+vertex_t *graph_versioned_add_vertex(graph_versioned_t *vgraph,
+const char *str);
+int graph_versioned_add_edge(graph_versioned_t *vgraph, const char *src,
+const char *dest, edge_type_t type);
+int graph_versioned_remove_edge(graph_versioned_t *vgraph, const char *src,
+const char *dest);
+graph_reader_t *graph_reader_register(graph_versioned_t *vgraph);
+void graph_reader_release(graph_reader_t *reader);
+const graph_csr_t *graph_read_begin(graph_versioned_t *vgraph,
+graph_reader_t *reader);
+void graph_read_end(graph_reader_t *reader);
 
 #endif /*GRAPH_H*/
@@ -0,0 +1,73 @@
+#include <time.h>
+#include "bench.h"
+
+static int bench_first;
+
+/**
+ * bench_now - reads the monotonic clock
+ * Return: the current time in seconds
+ */
+
+double bench_now(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec + now.tv_nsec / 1e9);
+}
+
+/**
+ * bench_rand - splitmix64 pseudo-random generator, so that a seed gives the
+ * same inputs on every platform
+ * @state: a pointer to the state of the generator
+ * Return: the next 64-bit pseudo-random number
+ */
+
+unsigned long bench_rand(unsigned long *state)
+{
+	unsigned long z = (*state += 0x9E3779B97F4A7C15UL);
+
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9UL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBUL;
+	return (z ^ (z >> 31));
+}
+
+/**
+ * bench_report - prints a measurement as an element of the results array
+ * @name: the name of the measurement
+ * @unit: what an item is
+ * @seconds: the total time measured
+ * @items: the total number of items processed
+ */
+
+void bench_report(const char *name, const char *unit, double seconds,
+		  size_t items)
+{
+	printf("%s\n    {\"name\": \"%s\", \"unit\": \"%s\", \"items\": %lu",
+	       bench_first ? "" : ",", name, unit, (unsigned long)items);
+	printf(", \"seconds\": %.6f, \"ns_per_item\": %.2f}", seconds,
+	       items ? seconds * 1e9 / items : 0);
+	bench_first = 0;
+}
+
+/**
+ * bench_json_begin - opens the JSON document and its results array
+ * @options: the options of the run
+ */
+
+void bench_json_begin(const bench_options_t *options)
+{
+	printf("{\n  \"size\": %lu, \"seed\": %lu, \"reps\": %lu,\n"
+	       "  \"results\": [", (unsigned long)options->size,
+	       options->seed, (unsigned long)options->reps);
+	bench_first = 1;
+}
+
+/**
+ * bench_json_end - closes the results array and the JSON document
+ */
+
+void bench_json_end(void)
+{
+	printf("\n  ]\n}\n");
+}
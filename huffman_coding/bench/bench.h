@@ -0,0 +1,36 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "../huffman.h"
+#include "tree_heap.h"
+
+#define BENCH_TREES 1000
+#define BENCH_TREE_HEAP 1024
+
+/**
+ * struct bench_options_s - Command line of the benchmark
+ *
+ * @size: Number of elements of the heaps and symbols of the large tree
+ * @seed: Seed of the generator
+ * @reps: Number of repetitions of each timed operation
+ * @suites: Comma-separated suites to run
+ */
+typedef struct bench_options_s
+{
+	size_t size;
+	unsigned long seed;
+	size_t reps;
+	const char *suites;
+} bench_options_t;
+
+double bench_now(void);
+unsigned long bench_rand(unsigned long *state);
+void bench_report(const char *name, const char *unit, double seconds,
+		  size_t items);
+void bench_json_begin(const bench_options_t *options);
+void bench_json_end(void);
+
+int bench_heap(const bench_options_t *options);
+int bench_tree(const bench_options_t *options);
+
+#endif /*BENCH_H*/
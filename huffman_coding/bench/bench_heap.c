@@ -0,0 +1,157 @@
+#include "bench.h"
+
+/**
+ * key_cmp - compares two keys of the heap suite
+ * @p1: a pointer to the first key
+ * @p2: a pointer to the second key
+ * Return: negative, zero or positive as for qsort
+ */
+
+static int key_cmp(void *p1, void *p2)
+{
+	size_t a = *(size_t *)p1, b = *(size_t *)p2;
+
+	return (a < b ? -1 : a > b);
+}
+
+/**
+ * heap_run - fills a heap with the keys then empties it, checking that
+ * they come out in order
+ * @keys: the keys
+ * @size: the number of keys
+ * @times: where to add the time of the insertions and of the extractions
+ * Return: 1 on success, 0 on failure
+ */
+
+static int heap_run(size_t *keys, size_t size, double *times)
+{
+	heap_t *heap = heap_create(key_cmp);
+	size_t i, *key, last = 0;
+	double start;
+	int ok = heap != NULL;
+
+	start = bench_now();
+	for (i = 0; ok && i < size; i++)
+		ok = heap_insert(heap, keys + i) != NULL;
+	times[0] += bench_now() - start;
+
+	start = bench_now();
+	for (i = 0; ok && i < size; i++)
+	{
+		key = heap_extract(heap);
+		ok = key && *key >= last;
+		last = ok ? *key : last;
+	}
+	times[1] += bench_now() - start;
+
+	heap_delete(heap, NULL);
+	return (ok);
+}
+
+/**
+ * heapify_run - builds a heap of the keys at once with heap_from_array
+ * @keys: the keys
+ * @size: the number of keys
+ * @times: where to add the time of the construction
+ * Return: 1 on success, 0 on failure
+ */
+
+static int heapify_run(size_t *keys, size_t size, double *times)
+{
+	void **data = malloc((size ? size : 1) * sizeof(void *));
+	heap_t *heap;
+	double start;
+	size_t i;
+
+	if (!data)
+		return (0);
+	for (i = 0; i < size; i++)
+		data[i] = keys + i;
+
+	start = bench_now();
+	heap = heap_from_array(data, size, key_cmp);
+	times[2] += bench_now() - start;
+
+	heap_delete(heap, NULL);
+	free(data);
+	return (heap != NULL);
+}
+
+/**
+ * tree_heap_run - does what heap_run does with the pointer-tree heap
+ * that heap_t replaced
+ * Each of its insertions walks the tree breadth first, so this only runs
+ * on the first BENCH_TREE_HEAP keys
+ * @keys: the keys
+ * @size: the number of keys
+ * @times: where to add the time of the insertions and of the extractions
+ * Return: 1 on success, 0 on failure
+ */
+
+static int tree_heap_run(size_t *keys, size_t size, double *times)
+{
+	tree_heap_t *heap = tree_heap_create(key_cmp);
+	size_t i, *key, last = 0;
+	double start;
+	int ok = heap != NULL;
+
+	start = bench_now();
+	for (i = 0; ok && i < size; i++)
+		ok = tree_heap_insert(heap, keys + i) != NULL;
+	times[0] += bench_now() - start;
+
+	start = bench_now();
+	for (i = 0; ok && i < size; i++)
+	{
+		key = tree_heap_extract(heap);
+		ok = key && *key >= last;
+		last = ok ? *key : last;
+	}
+	times[1] += bench_now() - start;
+
+	tree_heap_delete(heap, NULL);
+	return (ok);
+}
+
+/**
+ * bench_heap - the heap suite: times options->size insertions of random
+ * keys into an empty heap, then as many extractions, then the
+ * construction of the same heap by heap_from_array
+ * Then it times the insertions and extractions of up to BENCH_TREE_HEAP
+ * keys, with heap_t and with the pointer-tree heap it replaced
+ * @options: the options
+ * Return: 1 on success, 0 on failure
+ */
+
+int bench_heap(const bench_options_t *options)
+{
+	static const char * const names[] = {
+		"heap_insert", "heap_extract", "heap_from_array",
+		"heap_insert_small", "heap_extract_small",
+		"tree_heap_insert_small", "tree_heap_extract_small"
+	};
+	unsigned long state = options->seed;
+	double times[7] = {0, 0, 0, 0, 0, 0, 0};
+	size_t *keys, i, small = options->size;
+	int ok = 1;
+
+	keys = malloc((options->size ? options->size : 1) * sizeof(*keys));
+	if (!keys)
+		return (0);
+	for (i = 0; i < options->size; i++)
+		keys[i] = bench_rand(&state);
+	if (small > BENCH_TREE_HEAP)
+		small = BENCH_TREE_HEAP;
+
+	for (i = 0; ok && i < options->reps; i++)
+		ok = heap_run(keys, options->size, times) &&
+			heapify_run(keys, options->size, times) &&
+			heap_run(keys, small, times + 3) &&
+			tree_heap_run(keys, small, times + 5);
+	for (i = 0; ok && i < 7; i++)
+		bench_report(names[i], "elements", times[i],
+			     options->reps * (i < 3 ? options->size : small));
+
+	free(keys);
+	return (ok);
+}
@@ -0,0 +1,70 @@
+#include "bench.h"
+
+/**
+ * usage - prints the usage of the benchmark
+ * @name: the name of the program
+ * Return: EXIT_FAILURE
+ */
+
+static int usage(const char *name)
+{
+	fprintf(stderr, "Usage: %s [-n size] [-S seed] [-r reps]"
+		" [-u heap,tree]\n", name);
+	return (EXIT_FAILURE);
+}
+
+/**
+ * parse_options - reads the command line
+ * @ac: the number of arguments
+ * @av: the arguments
+ * @options: the options to fill in, defaults already set
+ * Return: 1 on success, 0 on an invalid command line
+ */
+
+static int parse_options(int ac, char **av, bench_options_t *options)
+{
+	int i;
+
+	for (i = 1; i < ac; i++)
+	{
+		if (i + 1 == ac || av[i][0] != '-' || !av[i][1] || av[i][2])
+			return (0);
+		else if (av[i][1] == 'n')
+			options->size = strtoul(av[++i], NULL, 10);
+		else if (av[i][1] == 'S')
+			options->seed = strtoul(av[++i], NULL, 10);
+		else if (av[i][1] == 'r')
+			options->reps = strtoul(av[++i], NULL, 10);
+		else if (av[i][1] == 'u')
+			options->suites = av[++i];
+		else
+			return (0);
+	}
+	return (options->reps > 0);
+}
+
+/**
+ * main - runs the benchmark suites on seeded random inputs, printing the
+ * measurements as a JSON document on stdout
+ * @ac: the number of arguments
+ * @av: the arguments
+ * Return: EXIT_SUCCESS, or EXIT_FAILURE on failure
+ */
+
+int main(int ac, char **av)
+{
+	bench_options_t options = {1000000, 1, 5, "heap,tree"};
+	int ok = 1;
+
+	if (!parse_options(ac, av, &options))
+		return (usage(av[0]));
+	bench_json_begin(&options);
+	if (strstr(options.suites, "heap"))
+		ok = ok && bench_heap(&options);
+	if (strstr(options.suites, "tree"))
+		ok = ok && bench_tree(&options);
+	bench_json_end();
+	if (!ok)
+		fprintf(stderr, "Benchmark failed\n");
+	return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
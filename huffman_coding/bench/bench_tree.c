@@ -0,0 +1,139 @@
+#include "bench.h"
+
+/**
+ * tree_heap - builds a Huffman tree through the priority queue whatever
+ * the input, as huffman_tree only does below HUFFMAN_HEAP_MAX symbols
+ * @data: the symbols
+ * @freq: their frequencies
+ * @size: the number of symbols
+ * Return: the root of the tree, or NULL on failure
+ */
+
+static binary_tree_node_t *tree_heap(char *data, size_t *freq, size_t size)
+{
+	heap_t *queue = huffman_priority_queue(data, freq, size);
+	binary_tree_node_t *root;
+
+	if (!queue)
+		return (NULL);
+	while (queue->size > 1)
+		if (!huffman_extract_and_insert(queue))
+			break;
+	root = queue->size == 1 ? queue->nodes[0] : NULL;
+	heap_delete(queue, root ? NULL : freeNestedNode);
+	return (root);
+}
+
+/**
+ * tree_run - times the construction of Huffman trees, from unsorted
+ * frequencies through the priority queue and through huffman_tree_fast,
+ * then from sorted frequencies through huffman_tree, then as flat trees
+ * from unsorted and sorted frequencies
+ * @data: the symbols
+ * @freq: the frequencies, unsorted
+ * @sorted: the same frequencies, sorted
+ * @size: the number of symbols
+ * @times: where to add the time of each of the five constructions
+ * Return: 1 on success, 0 on failure
+ */
+
+static int tree_run(char *data, size_t *freq, size_t *sorted, size_t size,
+		    double *times)
+{
+	binary_tree_node_t *root = NULL;
+	huffman_flat_tree_t *flat = NULL;
+	double start;
+	int i;
+
+	for (i = 0; i < 5; i++)
+	{
+		start = bench_now();
+		if (i == 0)
+			root = tree_heap(data, freq, size);
+		else if (i == 1)
+			root = huffman_tree_fast(data, freq, size);
+		else if (i == 2)
+			root = huffman_tree(data, sorted, size);
+		else
+			flat = huffman_flat_tree(data, i == 3 ? freq : sorted,
+						 size);
+		times[i] += bench_now() - start;
+		if (i < 3 ? !root : !flat)
+			return (0);
+		if (i < 3)
+			free_huffman_tree(root);
+		else
+			free(flat);
+	}
+	return (1);
+}
+
+/**
+ * size_ascending - qsort comparator of frequencies
+ * @a: a pointer to the first frequency
+ * @b: a pointer to the second frequency
+ * Return: negative, zero or positive as for qsort
+ */
+
+static int size_ascending(const void *a, const void *b)
+{
+	size_t x = *(const size_t *)a, y = *(const size_t *)b;
+
+	return (x < y ? -1 : x > y);
+}
+
+/**
+ * tree_suite - builds Huffman trees over random frequencies of a given
+ * number of symbols, then reports the time of each construction
+ * @options: the options
+ * @size: the number of symbols
+ * @builds: the number of trees built per repetition
+ * @suffix: appended to the names of the measurements
+ * Return: 1 on success, 0 on failure
+ */
+
+static int tree_suite(const bench_options_t *options, size_t size,
+		      size_t builds, const char *suffix)
+{
+	static const char * const names[] = {
+		"huffman_tree_heap", "huffman_tree_fast", "huffman_tree_sorted",
+		"huffman_flat_tree", "huffman_flat_tree_sorted"
+	};
+	unsigned long state = options->seed;
+	size_t *freq = malloc(2 * size * sizeof(size_t)), i;
+	char *data = malloc(size), name[64];
+	double times[5] = {0, 0, 0, 0, 0};
+	int ok = freq && data;
+
+	for (i = 0; ok && i < size; i++)
+		data[i] = (char)i, freq[i] = freq[size + i] =
+			1 + bench_rand(&state) % 1000000;
+	if (ok)
+		qsort(freq + size, size, sizeof(size_t), size_ascending);
+	for (i = 0; ok && i < options->reps * builds; i++)
+		ok = tree_run(data, freq, freq + size, size, times);
+	for (i = 0; ok && i < 5; i++)
+	{
+		sprintf(name, "%s%s", names[i], suffix);
+		bench_report(name, "symbols", times[i],
+			     options->reps * builds * size);
+	}
+	free(freq), free(data);
+	return (ok);
+}
+
+/**
+ * bench_tree - the tree suite: times the Huffman tree constructions on
+ * BENCH_TREES histograms of 8 symbols, where the priority queue is still
+ * used, and of a byte alphabet, then on a single histogram of
+ * options->size symbols
+ * @options: the options
+ * Return: 1 on success, 0 on failure
+ */
+
+int bench_tree(const bench_options_t *options)
+{
+	return (tree_suite(options, 8, BENCH_TREES, "_8") &&
+		tree_suite(options, 256, BENCH_TREES, "_256") &&
+		tree_suite(options, options->size, 1, ""));
+}
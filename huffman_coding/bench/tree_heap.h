@@ -0,0 +1,42 @@
+#ifndef TREE_HEAP_H
+#define TREE_HEAP_H
+
+#include "../heap/heap.h"
+
+/**
+ * struct tree_heap_s - The pointer-tree heap that heap_t replaced, kept
+ * in the benchmark as the baseline it is compared against
+ * @size: the size of the heap (number of nodes)
+ * @data_cmp: the function to compare two nodes data
+ * @root: a pointer to the root node of the heap
+ */
+
+typedef struct tree_heap_s
+{
+	size_t size;
+	int (*data_cmp)(void *, void *);
+	binary_tree_node_t *root;
+} tree_heap_t;
+
+/**
+ * struct tree_queue_s - Node structure in a binary tree node queue
+ * @node: a pointer to the binary tree node
+ * @next: a pointer to the next node in the queue
+ */
+
+typedef struct tree_queue_s
+{
+	binary_tree_node_t *node;
+	struct tree_queue_s *next;
+} tree_queue_t;
+
+tree_queue_t *tree_queue_push(tree_queue_t **queue, binary_tree_node_t *node);
+void tree_queue_advance(tree_queue_t **queue);
+void tree_queue_clear(tree_queue_t **queue);
+
+tree_heap_t *tree_heap_create(int (*data_cmp)(void *, void *));
+binary_tree_node_t *tree_heap_insert(tree_heap_t *heap, void *data);
+void *tree_heap_extract(tree_heap_t *heap);
+void tree_heap_delete(tree_heap_t *heap, void (*free_data)(void *));
+
+#endif /* TREE_HEAP_H */
@@ -0,0 +1,75 @@
+#include "tree_heap.h"
+
+/**
+ * recursive_node_free - program that recursively frees the binary tree nodes
+ * and their data
+ * @node: the current node to be freed
+ * @free_data: a pointer to the function that frees the data
+ * Return: nothing (void)
+ */
+
+static void recursive_node_free(binary_tree_node_t *node,
+				void (*free_data)(void *))
+{
+	if (node == NULL)
+	{
+		return;
+	}
+
+	recursive_node_free(node->left, free_data);
+	recursive_node_free(node->right, free_data);
+
+	if (free_data != NULL)
+	{
+		free_data(node->data);
+	}
+
+	free(node);
+}
+
+
+/**
+ * tree_heap_delete - program that deallocates a heap and its associated
+ * binary tree nodes
+ * @heap: a pointer to the heap to be deallocated
+ * @free_data: a pointer to the function that frees the data in nodes
+ *             (or NULL if not needed)
+ * Return: nothing (void)
+ */
+
+void tree_heap_delete(tree_heap_t *heap, void (*free_data)(void *))
+{
+	if (heap == NULL)
+	{
+		return;
+	}
+
+	recursive_node_free(heap->root, free_data);
+
+	free(heap);
+}
+
+/**
+ * tree_heap_create - program that creates a new heap data structure
+ * @data_cmp: a pointer to the comparison function for node data
+ * Return: a pointer to the created tree_heap_t structure, or NULL if it fails
+ */
+
+tree_heap_t *tree_heap_create(int (*data_cmp)(void *, void *))
+{
+	tree_heap_t *heap = NULL;
+
+	if (data_cmp == NULL)
+		return (NULL);
+
+	heap = malloc(sizeof(tree_heap_t));
+
+	if (heap == NULL)
+		return (NULL);
+
+	heap->size = 0;
+	heap->data_cmp = data_cmp;
+	heap->root = NULL;
+
+	return (heap);
+}
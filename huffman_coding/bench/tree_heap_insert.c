@@ -0,0 +1,137 @@
+#include "tree_heap.h"
+
+/**
+ * complete_binary_tree_insert - program that inserts a new node
+ * into a binary tree in a complete manner
+ * @root: the root of the binary tree
+ * @data: the data to be stored in the new node
+ * Return: a pointer to the newly inserted node
+ */
+
+static binary_tree_node_t *
+complete_binary_tree_insert(binary_tree_node_t *root, void *data)
+{
+	binary_tree_node_t *new_node = NULL;
+	tree_queue_t *queue = NULL;
+
+	if (!root)
+		return (binary_tree_node(NULL, data));
+
+	queue = tree_queue_push(&queue, root);
+
+	if (!queue)
+		return (NULL);
+
+	while (queue)
+	{
+		if (queue->node->left && queue->node->right)
+		{
+			if (!tree_queue_push(&queue, queue->node->left) ||
+			    !tree_queue_push(&queue, queue->node->right))
+			{
+				tree_queue_clear(&queue);
+				return (NULL);
+			}
+			tree_queue_advance(&queue);
+		}
+		else
+		{
+			new_node = binary_tree_node(queue->node, data);
+
+			if (!new_node)
+				return (NULL);
+
+			if (!queue->node->left)
+				queue->node->left = new_node;
+			else
+				queue->node->right = new_node;
+
+			tree_queue_clear(&queue);
+		}
+	}
+	return (new_node);
+}
+
+/**
+ * tree_sift_up - program that adjusts the position of
+ * a newly inserted node in a min-heap by moving it up the heap
+ * as long as necessary
+ * @new_node: a pointer to the newly inserted node
+ * @data_cmp: a function pointer for data comparison
+ * Return: a pointer to the final position of the adjusted node
+ */
+
+static binary_tree_node_t *tree_sift_up(binary_tree_node_t *new_node,
+					int (*data_cmp)(void *, void *))
+{
+	binary_tree_node_t *temp = NULL;
+	void *swap;
+
+	if (!data_cmp)
+		return (new_node);
+
+	temp = new_node;
+
+	while (temp && temp->parent &&
+	       data_cmp(temp->data, temp->parent->data) < 0)
+	{
+		swap = temp->data;
+		temp->data = temp->parent->data;
+		temp->parent->data = swap;
+		temp = temp->parent;
+	}
+	return (temp);
+}
+
+/**
+ * insert_into_heap - program that inserts a new node into a heap
+ * and performs min-heap adjustments
+ * @root: a pointer to the root of the heap
+ * @data_cmp: a function pointer for data comparison
+ * @data: the data to be stored in the new node
+ * Return: a pointer to the newly inserted node
+ */
+
+static binary_tree_node_t *insert_into_heap(binary_tree_node_t **root,
+					    int (*data_cmp)(void *, void *),
+					    void *data)
+{
+	binary_tree_node_t *new_node = NULL;
+
+	if (!root || !data_cmp || !data)
+		return (NULL);
+
+	new_node = complete_binary_tree_insert(*root, data);
+
+	if (!new_node)
+		return (NULL);
+	if (!*root)
+		*root = new_node;
+
+	new_node = tree_sift_up(new_node, data_cmp);
+
+	return (new_node);
+}
+
+/**
+ * tree_heap_insert - program that inserts a new node with data into a heap
+ * and updates heap properties
+ * @heap: a pointer to the heap structure
+ * @data: the data to be stored in the new node
+ * Return: a pointer to the newly inserted node
+ */
+
+binary_tree_node_t *tree_heap_insert(tree_heap_t *heap, void *data)
+{
+	binary_tree_node_t *new_node = NULL;
+
+	if (!heap || !data)
+		return (NULL);
+
+	new_node = insert_into_heap(&(heap->root), heap->data_cmp, data);
+
+	if (new_node)
+		heap->size++;
+
+	return (new_node);
+}
@@ -0,0 +1,78 @@
+#include "tree_heap.h"
+
+/**
+ * tree_queue_push - program that pushes a binary tree node
+ * into a node queue
+ * @queue: a pointer to the queue
+ * @node: a binary tree node to be pushed
+ * Return: a pointer to the newly created node in the queue
+ */
+
+tree_queue_t *tree_queue_push(tree_queue_t **queue, binary_tree_node_t *node)
+{
+	tree_queue_t *temp, *new_node = NULL;
+
+	if (!queue || !node)
+		return (NULL);
+
+	new_node = malloc(sizeof(tree_queue_t));
+
+	if (!new_node)
+		return (NULL);
+
+	new_node->node = node;
+	new_node->next = NULL;
+
+	if (!*queue)
+		*queue = new_node;
+	else
+	{
+		temp = *queue;
+
+		while (temp && temp->next)
+			temp = temp->next;
+
+		temp->next = new_node;
+	}
+
+	return (new_node);
+}
+
+
+/**
+ * tree_queue_advance - program that advances the node queue by removing
+ * the front element
+ * @queue: a pointer to the queue
+ * Return: nothing (void)
+ */
+
+void tree_queue_advance(tree_queue_t **queue)
+{
+	tree_queue_t *temp;
+
+	if (!queue || !*queue)
+		return;
+
+	temp = *queue;
+	*queue = (*queue)->next;
+
+	free(temp);
+}
+
+
+
+/**
+ * tree_queue_clear - program that clears the entire node queue
+ * by removing all elements
+ * @queue: a pointer to the queue
+ * Return: nothing (void)
+ */
+
+void tree_queue_clear(tree_queue_t **queue)
+{
+	if (!queue)
+		return;
+
+	while (*queue)
+		tree_queue_advance(queue);
+}
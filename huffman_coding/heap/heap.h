@@ -6,6 +6,10 @@
 #include <stddef.h>
 #include <string.h>
 
+#define HEAP_MIN_CAPACITY 16
+#define HEAP_PARENT(i) (((i) - 1) / 2)
+#define HEAP_LEFT(i) (2 * (i) + 1)
+
 /**
  * struct binary_tree_node_s - Binary tree node data structure
  * @data: the data stored in a node
@@ -25,63 +29,46 @@ typedef struct binary_tree_node_s
 
 /**
  * struct heap_s - Heap data structure
+ * The heap is implicit: the children of the node at index i are at
+ * indices 2i + 1 and 2i + 2 of @nodes, so that no operation allocates
+ * but the occasional doubling of @nodes
  * @size: the size of the heap (number of nodes)
+ * @capacity: the number of nodes @nodes can hold
  * @data_cmp: the function to compare two nodes data
- * @root: a pointer to the root node of the heap
+ * @nodes: the data of the nodes, the root first
+ *
+ * This breaks the API of the former pointer-tree heap: there is no more
+ * root node (its data is @nodes[0]), heap_insert returns the inserted data
+ * instead of the node holding it, and the helpers that walked the tree
+ * (push_bt_node_queue, n_node, swap_nodes, ...) are gone
  */
 
 typedef struct heap_s
 {
 	size_t size;
+	size_t capacity;
 	int (*data_cmp)(void *, void *);
-	binary_tree_node_t *root;
+	void **nodes;
 } heap_t;
 
 
-/**
- * struct binary_tree_node_queue_s - Node structure in
- * a binary tree node queue
- * @node: a pointer to the binary tree node
- * @next: a pointer to the next node in the queue
- */
-
-typedef struct binary_tree_node_queue_s
-{
-	binary_tree_node_t *node;
-	struct binary_tree_node_queue_s *next;
-} bt_node_queue_t;
-
-
 /* task 0 */
 heap_t *heap_create(int (*data_cmp)(void *, void *));
+heap_t *heap_from_array(void **data, size_t n,
+			int (*data_cmp)(void *, void *));
 
 /* task 1 */
 binary_tree_node_t *binary_tree_node(binary_tree_node_t *parent, void *data);
 
 /* task 2 */
-bt_node_queue_t *push_bt_node_queue(bt_node_queue_t **queue,
-				    binary_tree_node_t *node);
-void advance_bt_node_queue(bt_node_queue_t **queue);
-void clear_bt_node_queue(bt_node_queue_t **queue);
-binary_tree_node_t *complete_binary_tree_insert(binary_tree_node_t *root,
-						void *data);
-binary_tree_node_t *sift_up_min_heap(binary_tree_node_t *new_node,
-				     int (*data_cmp)(void *, void *));
-binary_tree_node_t *insert_into_heap(binary_tree_node_t **root,
-				     int (*data_cmp)(void *, void *),
-				     void *data);
-binary_tree_node_t *heap_insert(heap_t *heap, void *data);
+size_t sift_up_min_heap(heap_t *heap, size_t i);
+void *heap_insert(heap_t *heap, void *data);
 
 /* task 3 */
-binary_tree_node_t *swap_nodes(binary_tree_node_t *a, binary_tree_node_t *b);
-binary_tree_node_t *n_node(binary_tree_node_t *node, int n);
-binary_tree_node_t *restore_heapify(int (*data_cmp)(void *, void *),
-				    binary_tree_node_t *node);
-void *extract_root(heap_t *heap);
+size_t restore_heapify(heap_t *heap, size_t i);
 void *heap_extract(heap_t *heap);
 
 /* task 4 */
-void recursive_node_free(binary_tree_node_t *node, void (*free_data)(void *));
 void heap_delete(heap_t *heap, void (*free_data)(void *));
 
 #endif /* HEAP_H */
@@ -18,9 +18,62 @@ heap_t *heap_create(int (*data_cmp)(void *, void *))
 	if (heap == NULL)
 		return (NULL);
 
+	heap->nodes = malloc(HEAP_MIN_CAPACITY * sizeof(void *));
+
+	if (heap->nodes == NULL)
+	{
+		free(heap);
+		return (NULL);
+	}
+
 	heap->size = 0;
+	heap->capacity = HEAP_MIN_CAPACITY;
 	heap->data_cmp = data_cmp;
-	heap->root = NULL;
+
+	return (heap);
+}
+
+/**
+ * heap_from_array - program that creates a heap holding the data of an
+ * array, using Floyd's bottom-up heapify
+ * The data are copied in array order, then every node that has children
+ * is sifted down, from the last one to the root, which is O(n) instead
+ * of the O(n log n) of n insertions
+ * @data: the array of data
+ * @n: the number of data
+ * @data_cmp: a pointer to the comparison function for node data
+ * Return: a pointer to the created heap_t structure, or NULL if it fails
+ */
+
+heap_t *heap_from_array(void **data, size_t n, int (*data_cmp)(void *, void *))
+{
+	heap_t *heap = NULL;
+	size_t i;
+
+	if (data_cmp == NULL || (data == NULL && n > 0))
+		return (NULL);
+
+	heap = heap_create(data_cmp);
+
+	if (heap == NULL)
+		return (NULL);
+
+	if (n > heap->capacity)
+	{
+		free(heap->nodes);
+		heap->nodes = malloc(n * sizeof(void *));
+		if (heap->nodes == NULL)
+		{
+			free(heap);
+			return (NULL);
+		}
+		heap->capacity = n;
+	}
+
+	memcpy(heap->nodes, data, n * sizeof(void *));
+	heap->size = n;
+	for (i = n / 2; i > 0; i--)
+		restore_heapify(heap, i - 1);
 
 	return (heap);
 }
@@ -3,21 +3,120 @@
 
 #include <stdlib.h>
 #include <stddef.h>
+#include <limits.h>
 #include "heap/heap.h"
 
+#define HUFFMAN_NONE ((size_t)-1)
+#define HUFFMAN_CODE_BITS (sizeof(unsigned long) * CHAR_BIT)
+/* Below this many symbols, unsorted input is merged through the heap */
+#define HUFFMAN_HEAP_MAX 10
+
+typedef struct huffman_leaf_block_s huffman_leaf_block_t;
+
 /**
  * struct symbol_s - Structure that stores a char
  * and its associated frequency
+ * A symbol made by symbol_create is its own allocation, as is the
+ * binary_tree_node_t holding it. The leaves made by huffman_leaves for
+ * huffman_priority_queue, huffman_tree and huffman_tree_fast are carved,
+ * nodes and symbols, from one huffman_leaf_block_t instead. freeNestedNode
+ * (for heap_delete on a queue) and free_huffman_tree (for a tree) tell the
+ * two apart, so either frees queues and trees mixing both kinds
  * @data: The character
  * @freq: The associated frequency
+ * @order: The order the symbol was created in, which breaks the ties
+ *         between equal frequencies (the index of the character for a
+ *         leaf, the rank of the merge for an internal node)
+ * @block: The block the symbol and its node were carved from, or NULL if
+ *         they are allocations of their own
  */
 
 typedef struct symbol_s
 {
 	char data;
 	size_t freq;
+	size_t order;
+	huffman_leaf_block_t *block;
 } symbol_t;
 
+/**
+ * struct huffman_leaf_block_s - Header of the single allocation holding
+ * the leaves made by huffman_leaves: it is followed by their nodes, then
+ * by their symbols
+ * @live: the number of leaves of the block not freed yet; freeing the last
+ *        one frees the block
+ */
+
+struct huffman_leaf_block_s
+{
+	size_t live;
+};
+
+/**
+ * struct huffman_node_s - Node of a flat Huffman tree
+ * @freq: the frequency of the node, the sum of its children's
+ * @parent: the index of the parent node, or HUFFMAN_NONE for the root
+ * @left: the index of the left child, or HUFFMAN_NONE for a leaf
+ * @right: the index of the right child, or HUFFMAN_NONE for a leaf
+ * @data: the character of a leaf
+ */
+
+typedef struct huffman_node_s
+{
+	size_t freq;
+	size_t parent;
+	size_t left;
+	size_t right;
+	char data;
+} huffman_node_t;
+
+/**
+ * struct huffman_flat_tree_s - Huffman tree stored as one array of nodes,
+ * allocated along with the structure and freed with it by free()
+ * The leaves are the nodes 0 to @size - 1, in the order of the symbols,
+ * and the internal nodes follow in the order they were merged, so that
+ * a parent always comes after its children and the root is the last node
+ * @size: the number of symbols
+ * @root: the index of the root, 2 * @size - 2
+ * @nodes: the 2 * @size - 1 nodes
+ */
+
+typedef struct huffman_flat_tree_s
+{
+	size_t size;
+	size_t root;
+	huffman_node_t *nodes;
+} huffman_flat_tree_t;
+
+/**
+ * struct huffman_code_s - Huffman code of a symbol, packed so that an
+ * encoder emits it with one shift and one or
+ * @bits: the code, its first bit being the most significant of the
+ *        @length low bits
+ * @length: the number of bits of the code, at most HUFFMAN_CODE_BITS
+ * @data: the character
+ */
+
+typedef struct huffman_code_s
+{
+	unsigned long bits;
+	size_t length;
+	char data;
+} huffman_code_t;
+
+/**
+ * struct huffman_code_table_s - Huffman codes of all the symbols of a
+ * tree, allocated along with the structure and freed with it by free()
+ * @size: the number of symbols
+ * @codes: the codes, in the order of the symbols
+ */
+
+typedef struct huffman_code_table_s
+{
+	size_t size;
+	huffman_code_t *codes;
+} huffman_code_table_t;
+
 
 
 /* task 5 */
@@ -26,6 +125,8 @@ symbol_t *symbol_create(char data, size_t freq);
 
 /* task 6 */
 int compare_frequencies(void *p1, void *p2);
+binary_tree_node_t **huffman_leaves(char *data, size_t *freq, size_t size,
+				    size_t *order);
 heap_t *huffman_priority_queue(char *data, size_t *freq, size_t size);
 
 
@@ -35,13 +136,25 @@ int huffman_extract_and_insert(heap_t *priority_queue);
 
 /* task 8 */
 void freeNestedNode(void *data);
+int huffman_frequencies_sorted(size_t *freq, size_t size);
 binary_tree_node_t *huffman_tree(char *data, size_t *freq, size_t size);
+binary_tree_node_t *huffman_tree_two_queues(binary_tree_node_t **leaves,
+					    size_t size);
+int huffman_sort_frequencies(size_t *freq, size_t size, size_t *order);
+binary_tree_node_t *huffman_tree_fast(char *data, size_t *freq, size_t size);
 
 /* task 9 */
 int huffman_codes(char *data, size_t *freq, size_t size);
 void free_huffman_tree(binary_tree_node_t *root);
-size_t calculate_tree_depth(binary_tree_node_t *root, size_t depth);
-void print_huffman_codes_recursive(binary_tree_node_t *root, char *code,
-				   size_t depth);
+
+/* flat tree */
+huffman_flat_tree_t *huffman_flat_tree(char *data, size_t *freq, size_t size);
+size_t huffman_code_lengths(const huffman_flat_tree_t *tree, size_t *lengths);
+void print_huffman_flat_codes(const huffman_flat_tree_t *tree, size_t node,
+			      char *code, size_t depth);
+
+/* code table */
+huffman_code_table_t *huffman_code_table(const huffman_flat_tree_t *tree);
+int print_huffman_code_table(const huffman_code_table_t *table);
 
 #endif /* HUFFMAN_H */
@@ -0,0 +1,119 @@
+#include "huffman.h"
+
+/**
+ * huffman_code_table - program that generates the packed Huffman codes of
+ * all the symbols of a flat Huffman tree
+ * Every node comes before its parent in the array, so one pass from the
+ * root down to the leaves extends the code of each parent by one bit
+ * before its children need it
+ * @tree: the flat Huffman tree
+ * Return: a pointer to the table, to be freed with free(), or NULL on
+ *         failure or if a code is longer than HUFFMAN_CODE_BITS
+ */
+
+huffman_code_table_t *huffman_code_table(const huffman_flat_tree_t *tree)
+{
+	huffman_code_table_t *table;
+	huffman_code_t *internal, *code, *parent;
+	size_t n, i, p;
+
+	if (!tree)
+		return (NULL);
+
+	n = tree->size;
+	table = malloc(sizeof(*table) + n * sizeof(huffman_code_t));
+	internal = malloc(n * sizeof(huffman_code_t));
+	if (!table || !internal)
+	{
+		free(table), free(internal);
+		return (NULL);
+	}
+
+	table->size = n;
+	table->codes = (huffman_code_t *)(table + 1);
+	for (i = tree->root + 1; i > 0; i--)
+	{
+		code = i - 1 < n ? &table->codes[i - 1] : &internal[i - 1 - n];
+		code->data = tree->nodes[i - 1].data;
+		code->bits = 0, code->length = 0;
+		p = tree->nodes[i - 1].parent;
+		if (p == HUFFMAN_NONE)
+			continue;
+		parent = &internal[p - n];
+		if (parent->length == HUFFMAN_CODE_BITS)
+			break;
+		code->bits = parent->bits << 1;
+		code->bits |= tree->nodes[p].right == i - 1;
+		code->length = parent->length + 1;
+	}
+
+	free(internal);
+	if (i > 0)
+		free(table), table = NULL;
+	return (table);
+}
+
+/**
+ * code_key - program that aligns the bits of a code on the most
+ * significant bit of an unsigned long
+ * @code: the code
+ * Return: the aligned bits
+ */
+
+static unsigned long code_key(const huffman_code_t *code)
+{
+	if (code->length == 0)
+		return (0);
+
+	return (code->bits << (HUFFMAN_CODE_BITS - code->length));
+}
+
+/**
+ * compare_codes - qsort comparator of codes by their aligned bits
+ * @a: a pointer to the first code
+ * @b: a pointer to the second code
+ * Return: negative, zero or positive as for qsort
+ */
+
+static int compare_codes(const void *a, const void *b)
+{
+	unsigned long x = code_key(a), y = code_key(b);
+
+	return (x < y ? -1 : x > y);
+}
+
+/**
+ * print_huffman_code_table - program that prints the codes of a table as
+ * strings of '0' and '1'
+ * No code is a prefix of another, so sorting them on their aligned bits
+ * gives the order of a depth-first walk of the tree, left first, which is
+ * the order huffman_codes has always printed them in
+ * @table: the table
+ * Return: 1 on success, 0 on failure
+ */
+
+int print_huffman_code_table(const huffman_code_table_t *table)
+{
+	huffman_code_t *codes;
+	size_t i, j;
+
+	if (!table)
+		return (0);
+
+	codes = malloc(table->size * sizeof(*codes));
+	if (!codes)
+		return (0);
+
+	memcpy(codes, table->codes, table->size * sizeof(*codes));
+	qsort(codes, table->size, sizeof(*codes), compare_codes);
+	for (i = 0; i < table->size; i++)
+	{
+		printf("%c: ", codes[i].data);
+		for (j = codes[i].length; j > 0; j--)
+			putchar('0' + (int)(codes[i].bits >> (j - 1) & 1));
+		putchar('\n');
+	}
+
+	free(codes);
+	return (1);
+}
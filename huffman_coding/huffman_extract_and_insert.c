@@ -8,6 +8,8 @@
  * with the lowest frequency are combined to create a new parent node with
  * a frequency equal to the sum of the two, reducing the total number of nodes
  * and thus progressing the construction of the tree
+ * Each merge leaves one node less in the queue, so the new node is ranked
+ * after the ones merged before it from the size of the queue
  * @priority_queue: a pointer to the priority queue used to manage the nodes
  *                  in the Huffman tree
  * Return: 1 if the operation is successful, 0 otherwise
@@ -33,6 +35,7 @@ int huffman_extract_and_insert(heap_t *priority_queue)
 
 	if (combined_symbol == NULL)
 		return (0);
+	combined_symbol->order = (size_t)-1 - priority_queue->size;
 
 	node = binary_tree_node(NULL, combined_symbol);
 
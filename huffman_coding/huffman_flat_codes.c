@@ -0,0 +1,54 @@
+#include "huffman.h"
+
+/**
+ * huffman_code_lengths - program that computes the depth of every node of
+ * a flat Huffman tree, which for a leaf is the length of its code
+ * Every node comes before its parent in the array, so one pass from the
+ * root down to the leaves sees each parent before its children
+ * @tree: the flat Huffman tree
+ * @lengths: an array of 2 * tree->size - 1 depths to fill in
+ * Return: the depth of the tree
+ */
+
+size_t huffman_code_lengths(const huffman_flat_tree_t *tree, size_t *lengths)
+{
+	size_t i, max = 0;
+
+	lengths[tree->root] = 0;
+	for (i = tree->root; i > 0; i--)
+	{
+		lengths[i - 1] = lengths[tree->nodes[i - 1].parent] + 1;
+		if (lengths[i - 1] > max)
+			max = lengths[i - 1];
+	}
+
+	return (max);
+}
+
+/**
+ * print_huffman_flat_codes - program that recursively generates and
+ * prints the Huffman codes of the leaves of a flat Huffman tree
+ * @tree: the flat Huffman tree
+ * @node: the index of the current node
+ * @code: the current code generated during traversal
+ * @depth: the current depth of the node
+ * Return: nothing (void)
+ */
+
+void print_huffman_flat_codes(const huffman_flat_tree_t *tree, size_t node,
+			      char *code, size_t depth)
+{
+	const huffman_node_t *n = &tree->nodes[node];
+
+	if (n->left == HUFFMAN_NONE)
+	{
+		code[depth] = '\0';
+		printf("%c: %s\n", n->data, code);
+		return;
+	}
+
+	code[depth] = '0';
+	print_huffman_flat_codes(tree, n->left, code, depth + 1);
+	code[depth] = '1';
+	print_huffman_flat_codes(tree, n->right, code, depth + 1);
+}
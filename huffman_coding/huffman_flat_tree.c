@@ -0,0 +1,164 @@
+#include "huffman.h"
+
+/**
+ * compare_nodes - program that compares two nodes of a flat Huffman tree
+ * the way compare_frequencies compares the nodes of a linked one: by
+ * frequency, then a leaf before an internal node, then by creation order
+ * Leaves come first in the array and internal nodes follow in the order
+ * they were merged, so the last two are the order of the indices
+ * @p1: a pointer to the first node
+ * @p2: a pointer to the second node
+ * Return: a negative number, zero or a positive number if the first node
+ *         comes before, is or comes after the second one
+ */
+
+static int compare_nodes(void *p1, void *p2)
+{
+	huffman_node_t *node1 = (huffman_node_t *)p1;
+	huffman_node_t *node2 = (huffman_node_t *)p2;
+
+	if (node1->freq != node2->freq)
+		return (node1->freq < node2->freq ? -1 : 1);
+
+	return (node1 < node2 ? -1 : node1 > node2);
+}
+
+/**
+ * flat_merge - program that makes a node of a flat Huffman tree the
+ * parent of two others
+ * @nodes: the nodes of the tree
+ * @k: the index of the new parent
+ * @a: the index of its left child
+ * @b: the index of its right child
+ * Return: nothing (void)
+ */
+
+static void flat_merge(huffman_node_t *nodes, size_t k, size_t a, size_t b)
+{
+	nodes[k].freq = nodes[a].freq + nodes[b].freq;
+	nodes[k].parent = HUFFMAN_NONE;
+	nodes[k].left = a;
+	nodes[k].right = b;
+	nodes[k].data = -1;
+	nodes[a].parent = nodes[b].parent = k;
+}
+
+/**
+ * flat_merge_heap - program that merges the nodes of a flat Huffman tree
+ * through a priority queue, as huffman_extract_and_insert does
+ * @tree: the tree, whose leaves are set up
+ * Return: 1 on success, 0 on failure
+ */
+
+static int flat_merge_heap(huffman_flat_tree_t *tree)
+{
+	huffman_node_t *nodes = tree->nodes, *a, *b;
+	heap_t *heap = NULL;
+	void **leaves;
+	size_t k;
+
+	leaves = malloc(tree->size * sizeof(void *));
+	for (k = 0; leaves && k < tree->size; k++)
+		leaves[k] = &nodes[k];
+	if (leaves)
+		heap = heap_from_array(leaves, tree->size, compare_nodes);
+	free(leaves);
+
+	for (k = tree->size; heap && k <= tree->root; k++)
+	{
+		a = heap_extract(heap);
+		b = heap_extract(heap);
+		flat_merge(nodes, k, a - nodes, b - nodes);
+		if (!heap_insert(heap, &nodes[k]))
+			break;
+	}
+
+	heap_delete(heap, NULL);
+	return (heap && k > tree->root);
+}
+
+/**
+ * flat_merge_two_queues - program that merges the nodes of a flat Huffman
+ * tree in linear time, taking its leaves by ascending frequency, as
+ * huffman_tree_two_queues does
+ * Leaves of equal frequency are taken by index, which is the order
+ * compare_nodes gives them, so the tree is the one flat_merge_heap builds
+ * @tree: the tree, whose leaves are set up
+ * @order: the indices of the leaves sorted by ascending frequency, as
+ *         huffman_sort_frequencies sorts them, or NULL if they already are
+ * Return: nothing (void)
+ */
+
+static void flat_merge_two_queues(huffman_flat_tree_t *tree,
+				  const size_t *order)
+{
+	huffman_node_t *nodes = tree->nodes;
+	size_t next = 0, head = tree->size, k, pick[2], i, leaf;
+
+	for (k = tree->size; k <= tree->root; k++)
+	{
+		for (i = 0; i < 2; i++)
+		{
+			leaf = order && next < tree->size ? order[next] : next;
+			if (next < tree->size &&
+			    (head == k || nodes[leaf].freq <= nodes[head].freq))
+				pick[i] = leaf, next++;
+			else
+				pick[i] = head++;
+		}
+		flat_merge(nodes, k, pick[0], pick[1]);
+	}
+}
+
+/**
+ * huffman_flat_tree - program that constructs a Huffman tree as a single
+ * array of nodes, which takes one allocation instead of two per node
+ * The merges are the same as those of huffman_tree, so the tree is the same,
+ * and so is the choice between the two queues and the priority queue
+ * @data: an array of characters
+ * @freq: an array of frequencies associated with characters
+ * @size: the size of the arrays
+ * Return: a pointer to the tree, to be freed with free(), or NULL on failure
+ */
+
+huffman_flat_tree_t *huffman_flat_tree(char *data, size_t *freq, size_t size)
+{
+	huffman_flat_tree_t *tree;
+	size_t i, *order;
+	int ok = 1;
+
+	if (!data || !freq || size == 0)
+		return (NULL);
+
+	tree = malloc(sizeof(*tree) + (2 * size - 1) * sizeof(huffman_node_t));
+	if (!tree)
+		return (NULL);
+
+	tree->size = size;
+	tree->root = 2 * size - 2;
+	tree->nodes = (huffman_node_t *)(tree + 1);
+	for (i = 0; i < size; i++)
+	{
+		tree->nodes[i].freq = freq[i];
+		tree->nodes[i].parent = HUFFMAN_NONE;
+		tree->nodes[i].left = tree->nodes[i].right = HUFFMAN_NONE;
+		tree->nodes[i].data = data[i];
+	}
+
+	if (huffman_frequencies_sorted(freq, size))
+		flat_merge_two_queues(tree, NULL);
+	else if (size < HUFFMAN_HEAP_MAX)
+		ok = flat_merge_heap(tree);
+	else
+	{
+		order = malloc(size * sizeof(size_t));
+		ok = order && huffman_sort_frequencies(freq, size, order);
+		if (ok)
+			flat_merge_two_queues(tree, order);
+		free(order);
+	}
+	if (!ok)
+		free(tree), tree = NULL;
+
+	return (tree);
+}
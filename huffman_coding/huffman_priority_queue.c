@@ -5,47 +5,116 @@
  * of two symbol nodes
  * the purpose of this comparison is to determine the order in which symbols
  * should be arranged or sorted based on their frequencies
+ * Ties are broken so that the order is total: a leaf comes before an
+ * internal node, then the node created first comes first. The two lowest
+ * nodes are then the same whatever the shape of the heap, and the same as
+ * the ones huffman_tree_two_queues picks, so every construction gives the
+ * same tree
  * @p1: a pointer to the first symbol node
  * @p2: a pointer to the second symbol node
- * Return: the difference between the frequencies of the symbols
+ * Return: a negative number, zero or a positive number if the first node
+ *         comes before, ties with or comes after the second one
  */
 
 int compare_frequencies(void *p1, void *p2)
 {
 	binary_tree_node_t *node1, *node2;
 	symbol_t *symbol1, *symbol2;
+	int leaf1, leaf2;
 
 	node1 = (binary_tree_node_t *)p1;
 	node2 = (binary_tree_node_t *)p2;
 	symbol1 = (symbol_t *)node1->data;
 	symbol2 = (symbol_t *)node2->data;
 
-	return (symbol1->freq - symbol2->freq);
+	if (symbol1->freq != symbol2->freq)
+		return (symbol1->freq < symbol2->freq ? -1 : 1);
+
+	leaf1 = !node1->left && !node1->right;
+	leaf2 = !node2->left && !node2->right;
+	if (leaf1 != leaf2)
+		return (leaf1 ? -1 : 1);
+
+	if (symbol1->order != symbol2->order)
+		return (symbol1->order < symbol2->order ? -1 : 1);
+
+	return (0);
+}
+
+/**
+ * huffman_leaves - program that creates the leaves of a Huffman tree,
+ * carving their nodes and symbols from a single huffman_leaf_block_t
+ * instead of allocating each one
+ * @data: an array of characters
+ * @freq: an array of frequencies associated with characters
+ * @size: the size of the arrays
+ * @order: the indices of the symbols in the order of the leaves, or NULL
+ *         to keep the order of the arrays
+ * Return: an array of @size leaves, to be freed with free() once they are
+ *         owned by a tree or a queue, or NULL on failure
+ */
+
+binary_tree_node_t **huffman_leaves(char *data, size_t *freq, size_t size,
+				    size_t *order)
+{
+	binary_tree_node_t **leaves, *nodes;
+	huffman_leaf_block_t *block;
+	symbol_t *symbols;
+	size_t i, j;
+
+	leaves = malloc((size ? size : 1) * sizeof(*leaves));
+	block = malloc(sizeof(*block) + size * (sizeof(binary_tree_node_t) +
+						sizeof(symbol_t)));
+	if (!leaves || !block || size == 0)
+	{
+		free(block);
+		if (!leaves || size == 0)
+			return (leaves);
+		free(leaves);
+		return (NULL);
+	}
+
+	block->live = size;
+	nodes = (binary_tree_node_t *)(block + 1);
+	symbols = (symbol_t *)(nodes + size);
+	for (i = 0; i < size; i++)
+	{
+		j = order ? order[i] : i;
+		symbols[i].data = data[j], symbols[i].freq = freq[j];
+		symbols[i].order = j, symbols[i].block = block;
+		nodes[i].data = symbols + i;
+		nodes[i].left = nodes[i].right = nodes[i].parent = NULL;
+		leaves[i] = nodes + i;
+	}
+	return (leaves);
 }
 
 /**
  * huffman_priority_queue - program that creates a min-heap priority queue
  * of symbols
+ * The leaves holding the symbols are created first, then heapified at
+ * once by heap_from_array
  * @data: an array of characters
  * @freq: an array of frequencies associated with characters
  * @size: the size of the arrays
- * Return: a min-heapified version of the arrays
+ * Return: a min-heapified version of the arrays, or NULL on failure
  */
 
 heap_t *huffman_priority_queue(char *data, size_t *freq, size_t size)
 {
+	binary_tree_node_t **leaves;
 	heap_t *heap;
-	symbol_t *symbol;
-	binary_tree_node_t *node;
 	size_t i;
 
-	heap = heap_create(compare_frequencies);
+	leaves = huffman_leaves(data, freq, size, NULL);
 
-	for (i = 0; i < size; i++)
-	{
-		symbol = symbol_create(data[i], freq[i]);
-		node = binary_tree_node(NULL, symbol);
-		node = heap_insert(heap, node);
-	}
+	if (!leaves)
+		return (NULL);
+
+	heap = heap_from_array((void **)leaves, size, compare_frequencies);
+
+	for (i = 0; !heap && i < size; i++)
+		freeNestedNode(leaves[i]);
+	free(leaves);
 	return (heap);
 }
@@ -5,6 +5,8 @@
  * to heap_delete
  * this function frees memory allocated for a binary_tree_node_t node
  * containing a symbol_t struct
+ * A leaf carved from a huffman_leaf_block_t is not an allocation of its
+ * own: it is counted off its block, which is freed with its last leaf
  * @data: the void pointer intended to be cast into binary_tree_node_t pointer
  * Return: nothing (void)
  */
@@ -20,6 +22,13 @@ void freeNestedNode(void *data)
 	{
 		symbol_data = (symbol_t *)(node_data->data);
 
+		if (symbol_data && symbol_data->block)
+		{
+			if (--symbol_data->block->live == 0)
+				free(symbol_data->block);
+			return;
+		}
+
 		if (symbol_data)
 			free(symbol_data);
 
@@ -27,9 +36,44 @@ void freeNestedNode(void *data)
 	}
 }
 
+/**
+ * free_subtree - program that is used as a free_data parameter to
+ * heap_delete for a priority queue holding partly built Huffman trees
+ * @data: the void pointer intended to be cast into binary_tree_node_t pointer
+ * Return: nothing (void)
+ */
+
+static void free_subtree(void *data)
+{
+	free_huffman_tree((binary_tree_node_t *)data);
+}
+
+/**
+ * huffman_frequencies_sorted - program that checks whether frequencies are
+ * in ascending order
+ * @freq: an array of frequencies
+ * @size: the size of the array
+ * Return: 1 if they are, 0 otherwise
+ */
+
+int huffman_frequencies_sorted(size_t *freq, size_t size)
+{
+	size_t i;
+
+	for (i = 1; i < size; i++)
+		if (freq[i] < freq[i - 1])
+			return (0);
+	return (1);
+}
+
 /**
  * huffman_tree - program that constructs a Huffman tree using character data
  * and their frequencies
+ * The tree is built in linear time by huffman_tree_two_queues, straight
+ * from the leaves when the frequencies are already sorted and after
+ * huffman_tree_fast sorts them otherwise; below HUFFMAN_HEAP_MAX symbols,
+ * where the sort costs more than it saves, unsorted input goes through a
+ * priority queue instead. All three give the same tree
  * @data: an array of characters
  * @freq: an array of frequencies associated with characters
  * @size: the size of the arrays
@@ -39,27 +83,37 @@ void freeNestedNode(void *data)
 binary_tree_node_t *huffman_tree(char *data, size_t *freq, size_t size)
 {
 	heap_t *priority_queue = NULL;
-	binary_tree_node_t *huffman_root = NULL;
+	binary_tree_node_t *huffman_root = NULL, **leaves;
 
 	if (!data || !freq || size == 0)
 		return (NULL);
 
+	if (huffman_frequencies_sorted(freq, size))
+	{
+		leaves = huffman_leaves(data, freq, size, NULL);
+		if (leaves)
+			huffman_root = huffman_tree_two_queues(leaves, size);
+		free(leaves);
+		return (huffman_root);
+	}
+	if (size >= HUFFMAN_HEAP_MAX)
+		return (huffman_tree_fast(data, freq, size));
+
 	priority_queue = huffman_priority_queue(data, freq, size);
 
 	if (!priority_queue)
 		return (NULL);
 
-	while (priority_queue->root && (priority_queue->root->left ||
-					priority_queue->root->right))
+	while (priority_queue->size > 1)
 	{
 		if (!huffman_extract_and_insert(priority_queue))
 		{
-			heap_delete(priority_queue, freeNestedNode);
+			heap_delete(priority_queue, free_subtree);
 			return (NULL);
 		}
 	}
 
-	huffman_root = (binary_tree_node_t *)(priority_queue->root->data);
+	huffman_root = (binary_tree_node_t *)(priority_queue->nodes[0]);
 	heap_delete(priority_queue, NULL);
 
 	return (huffman_root);
@@ -0,0 +1,156 @@
+#include "huffman.h"
+
+/**
+ * pick_lowest - program that takes the node of lowest frequency off the
+ * fronts of the two queues of the linear-time construction
+ * @leaves: the leaves, sorted by ascending frequency
+ * @size: the number of leaves
+ * @next: the index of the next leaf to take, updated
+ * @merged: the merged nodes, created by ascending frequency
+ * @head: the index of the next merged node to take, updated
+ * @tail: the number of merged nodes
+ * Return: the node of lowest frequency, a leaf on ties
+ */
+
+static binary_tree_node_t *pick_lowest(binary_tree_node_t **leaves,
+				       size_t size, size_t *next,
+				       binary_tree_node_t **merged,
+				       size_t *head, size_t tail)
+{
+	if (*next < size &&
+	    (*head == tail || ((symbol_t *)leaves[*next]->data)->freq <=
+	     ((symbol_t *)merged[*head]->data)->freq))
+		return (leaves[(*next)++]);
+
+	return (merged[(*head)++]);
+}
+
+/**
+ * huffman_tree_two_queues - program that constructs a Huffman tree in
+ * linear time from leaves sorted by ascending frequency
+ * The merged nodes are created by ascending frequency too, so the two
+ * lowest nodes are always at the fronts of the leaves and of the merged
+ * nodes, and no priority queue is needed
+ * @leaves: an array of leaves sorted by ascending frequency, which become
+ *          part of the tree (or are freed on failure); the array itself
+ *          stays the caller's
+ * @size: the number of leaves
+ * Return: a pointer to the root node of the constructed Huffman tree,
+ *         or NULL on failure
+ */
+
+binary_tree_node_t *huffman_tree_two_queues(binary_tree_node_t **leaves,
+					    size_t size)
+{
+	binary_tree_node_t **merged, *node, *root;
+	size_t next = 0, head = 0, tail = 0;
+	symbol_t *symbol;
+
+	merged = malloc((size > 1 ? size - 1 : 1) * sizeof(*merged));
+	while (merged && tail + 1 < size)
+	{
+		symbol = symbol_create(-1, 0);
+		node = symbol ? binary_tree_node(NULL, symbol) : NULL;
+		if (!node)
+		{
+			free(symbol);
+			break;
+		}
+		node->left = pick_lowest(leaves, size, &next, merged, &head,
+					 tail);
+		node->right = pick_lowest(leaves, size, &next, merged, &head,
+					  tail);
+		node->left->parent = node->right->parent = node;
+		symbol->freq = ((symbol_t *)node->left->data)->freq +
+			((symbol_t *)node->right->data)->freq;
+		merged[tail++] = node;
+	}
+
+	root = !merged || tail + 1 < size ? NULL :
+		size == 1 ? leaves[0] : merged[tail - 1];
+	if (!root)
+	{
+		while (merged && head < tail)
+			free_huffman_tree(merged[head++]);
+		while (next < size)
+			freeNestedNode(leaves[next++]);
+	}
+	free(merged);
+	return (root);
+}
+
+/**
+ * huffman_sort_frequencies - program that sorts the indices of symbols by
+ * ascending frequency, with a stable radix sort on the bytes of the
+ * frequencies, skipping the high bytes that are zero in all of them
+ * @freq: an array of frequencies
+ * @size: the size of the array
+ * @order: an array of @size indices to fill in
+ * Return: 1 on success, 0 on failure
+ */
+
+int huffman_sort_frequencies(size_t *freq, size_t size, size_t *order)
+{
+	size_t count[256], *tmp, *src = order, *dst, *swap, i, max = 0, shift;
+	size_t byte;
+
+	dst = tmp = malloc(size * sizeof(size_t));
+	if (!tmp)
+		return (0);
+	for (i = 0; i < size; i++)
+	{
+		order[i] = i;
+		if (freq[i] > max)
+			max = freq[i];
+	}
+	for (shift = 0; shift < 8 * sizeof(size_t) && max >> shift; shift += 8)
+	{
+		memset(count, 0, sizeof(count));
+		for (i = 0; i < size; i++)
+			count[(freq[src[i]] >> shift) & 0xff]++;
+		for (i = 1; i < 256; i++)
+			count[i] += count[i - 1];
+		for (i = size; i > 0; i--)
+		{
+			byte = (freq[src[i - 1]] >> shift) & 0xff;
+			dst[--count[byte]] = src[i - 1];
+		}
+		swap = src, src = dst, dst = swap;
+	}
+	if (src != order)
+		memcpy(order, src, size * sizeof(size_t));
+	free(tmp);
+	return (1);
+}
+
+/**
+ * huffman_tree_fast - program that constructs a Huffman tree in O(n)
+ * from unsorted frequencies, sorting them with a radix sort first
+ * For a byte alphabet, the sort is a few counting passes over 256 entries
+ * @data: an array of characters
+ * @freq: an array of frequencies associated with characters
+ * @size: the size of the arrays
+ * Return: a pointer to the root node of the constructed Huffman tree,
+ *         or NULL on failure
+ */
+
+binary_tree_node_t *huffman_tree_fast(char *data, size_t *freq, size_t size)
+{
+	binary_tree_node_t **leaves = NULL, *root;
+	size_t *order;
+
+	if (!data || !freq || size == 0)
+		return (NULL);
+
+	order = malloc(size * sizeof(size_t));
+	if (order && huffman_sort_frequencies(freq, size, order))
+		leaves = huffman_leaves(data, freq, size, order);
+	free(order);
+
+	if (!leaves)
+		return (NULL);
+
+	root = huffman_tree_two_queues(leaves, size);
+	free(leaves);
+	return (root);
+}
@@ -18,6 +18,8 @@ symbol_t *symbol_create(char data, size_t freq)
 	}
 	symbol->data = data;
 	symbol->freq = freq;
+	symbol->order = 0;
+	symbol->block = NULL;
 
 	return (symbol);
 }
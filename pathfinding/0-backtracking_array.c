@@ -35,6 +35,8 @@ queue_t *backtracking_array(char **map, int rows, int cols,
 		strcpy(mymap[i], map[i]);
 	}
 
+	STATS_BEGIN(GRAPH_PHASE_SEARCH);
+	STATS_ADD(bytes_allocated, rows * (sizeof(char *) + cols + 1));
 	if (backtrack(mymap, rows, cols, target, start->x, start->y, path))
 	{
 		while ((point = dequeue(path)))
@@ -47,6 +49,7 @@ queue_t *backtracking_array(char **map, int rows, int cols,
 		free(reverse_path);
 		reverse_path = NULL;
 	}
+	STATS_END(GRAPH_PHASE_SEARCH);
 	for (i = 0; i < rows; i++)
 		free(mymap[i]);
 	free(mymap);
@@ -74,6 +77,7 @@ int backtrack(char **map, int rows, int cols, point_t const *target,
 		return (0);
 
 	map[y][x] = '1';
+	STATS_ADD(vertices_visited, 1);
 
 	point = calloc(1, sizeof(*point));
 
@@ -89,6 +93,8 @@ int backtrack(char **map, int rows, int cols, point_t const *target,
 	if (x == target->x && y == target->y)
 		return (1);
 
+	STATS_ADD(edges_scanned, 4);
+
 	if (backtrack(map, rows, cols, target, x + 1, y, path) ||
 		backtrack(map, rows, cols, target, x, y + 1, path) ||
 		backtrack(map, rows, cols, target, x - 1, y, path) ||
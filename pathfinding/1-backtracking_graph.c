@@ -6,13 +6,14 @@
  * @saw: the array indicating whether a vertex has been visited
  *       (1 if visited, 0 otherwise)
  * @current: the current vertex being explored
- * @target: the content of the target vertex we are searching for
+ * @target: the target vertex we are searching for, vertices being
+ *          unique by content so that a pointer comparison is enough
  * Return: a node if the target is found and added to the queue,
  *         otherwise NULL
  */
 
 queue_node_t *graph_fill(queue_t *new_node, int *saw, const vertex_t *current,
-			 char *target)
+			 const vertex_t *target)
 {
 	edge_t *e;
 
@@ -21,11 +22,13 @@ queue_node_t *graph_fill(queue_t *new_node, int *saw, const vertex_t *current,
 
 	printf("Checking %s\n", current->content);
 
-	if (!strcmp(current->content, target))
+	if (current == target)
 		return (queue_push_front(new_node,
 					 strdup(current->content)));
 
 	saw[current->index] = 1;
+	STATS_ADD(vertices_visited, 1);
+	STATS_ADD(edges_scanned, current->nb_edges);
 
 	for (e = current->edges; e != NULL; e = e->next)
 		if (graph_fill(new_node, saw, e->dest, target))
@@ -62,11 +65,14 @@ queue_t *backtracking_graph(graph_t *graph, vertex_t const *start,
 	if (saw == NULL)
 		return (NULL);
 
-	if (graph_fill(new_node, saw, start, target->content) == NULL)
+	STATS_BEGIN(GRAPH_PHASE_SEARCH);
+	STATS_ADD(bytes_allocated, graph->nb_vertices * sizeof(*saw));
+	if (graph_fill(new_node, saw, start, target) == NULL)
 	{
 		queue_delete(new_node);
 		new_node = NULL;
 	}
+	STATS_END(GRAPH_PHASE_SEARCH);
 	free(saw);
 
 	return (new_node);
@@ -109,6 +109,8 @@ void recursive_a_star(graph_t *graph, size_t *visited, vertex_t **came_from,
 			target->content, f_score[current->index]);
 	i = current->index;
 	edge = current->edges;
+	STATS_ADD(vertices_visited, 1);
+	STATS_ADD(edges_scanned, current->nb_edges);
 	while (edge && visited[i] == 0)
 	{
 		neighbor = edge->dest;
@@ -176,6 +178,8 @@ int initialize_a_star(graph_t *graph, size_t **visited, vertex_t ***came_from,
 		(*f_score)[i] = ULONG_MAX;
 		(*g_score)[i] = ULONG_MAX;
 	}
+	STATS_ADD(bytes_allocated, graph->nb_vertices * (sizeof(**visited) +
+		sizeof(***came_from) + sizeof(**f_score) + sizeof(**g_score)));
 	(*g_score)[start->index] = 0;
 	(*f_score)[start->index] = h(start->x, start->y,
 							target->x, target->y);
@@ -210,9 +214,11 @@ queue_t *a_star_graph(graph_t *graph, vertex_t const *start,
 
 	queue = queue_create();
 
+	STATS_BEGIN(GRAPH_PHASE_SEARCH);
 	recursive_a_star(graph, visited, came_from, start, target,
 		f_score, g_score, 0);
 	reconstruct_path(graph, queue, came_from, start, target);
+	STATS_END(GRAPH_PHASE_SEARCH);
 
 	free(visited), free(f_score), free(g_score), free(came_from);
 
@@ -7,6 +7,24 @@ static vertex_t **verts;
 
 #define STRDUP(x) ((str = strdup(x)) ? str : (exit(1), NULL))
 
+/**
+ * relax - settles a vertex and updates the distances of its neighbours
+ * @j: index of the closest unsettled vertex
+ */
+static void relax(ssize_t j)
+{
+	edge_t *e;
+
+	STATS_ADD(vertices_visited, 1);
+	STATS_ADD(edges_scanned, verts[j]->nb_edges);
+	for (e = verts[j]->edges; e; e = e->next)
+		if (dists[e->dest->index] >= 0 &&
+			dists[j] + e->weight < dists[e->dest->index])
+			dists[e->dest->index] = dists[j] + e->weight,
+				from[e->dest->index] = verts[j];
+	dists[j] = -1;
+}
+
 /**
  * dijkstra_graph - uses Dijkstra's Algo to find path
  * @graph: pointer to graph struct
@@ -19,7 +37,6 @@ queue_t *dijkstra_graph(graph_t *graph, vertex_t const *start,
 {
 	ssize_t i, d, j = -1;
 	vertex_t *v;
-	edge_t *e;
 	queue_t *path = queue_create();
 	char *str;
 
@@ -30,6 +47,9 @@ queue_t *dijkstra_graph(graph_t *graph, vertex_t const *start,
 	verts = calloc(graph->nb_vertices, sizeof(*verts));
 	if (!dists || !from || !verts || !path)
 		return (NULL);
+	STATS_BEGIN(GRAPH_PHASE_SEARCH);
+	STATS_ADD(bytes_allocated, graph->nb_vertices *
+		(sizeof(*dists) + sizeof(*from) + sizeof(*verts)));
 	for (v = graph->vertices; v; v = v->next)
 		verts[v->index] = v, dists[v->index] = INT_MAX;
 	dists[start->index] = 0, from[start->index] = NULL;
@@ -42,13 +62,9 @@ queue_t *dijkstra_graph(graph_t *graph, vertex_t const *start,
 			break;
 		printf("Checking %s, distance from %s is %d\n",
 			verts[j]->content, start->content, dists[j]);
-		for (e = verts[j]->edges; e; e = e->next)
-			if (dists[e->dest->index] >= 0 &&
-				dists[j] + e->weight < dists[e->dest->index])
-				dists[e->dest->index] = dists[j] + e->weight,
-					from[e->dest->index] = verts[j];
-		dists[j] = -1;
+		relax(j);
 	}
+	STATS_END(GRAPH_PHASE_SEARCH);
 	if (j != -1)
 		for (queue_push_front(path, STRDUP(verts[j]->content));
 			j != (ssize_t)start->index; j = from[j]->index)
@@ -0,0 +1,150 @@
+#include "pathfinding.h"
+
+#define CHECK_SIDE 48
+#define CHECK_PAIRS 200
+#define CHECK_FILE "check.graph"
+
+/**
+ * grid_link - joins two vertices of the grid both ways by edges of the
+ * same weight
+ * @a: the first vertex
+ * @b: the second vertex
+ * @edges: the next two free edges of the edge block
+ * @weight: the weight of the edges
+ */
+
+static void grid_link(vertex_t *a, vertex_t *b, edge_t *edges, int weight)
+{
+	edges[0].dest = b, edges[0].weight = weight;
+	edges[0].next = a->edges, a->edges = edges, a->nb_edges++;
+	edges[1].dest = a, edges[1].weight = weight;
+	edges[1].next = b->edges, b->edges = edges + 1, b->nb_edges++;
+}
+
+/**
+ * grid_create - builds a weighted square grid, each vertex joined to its
+ * right and lower neighbours by edges of weight 1 to 9
+ * The vertices, edges and contents are carved from three blocks, starting
+ * at graph->vertices, *edges and graph->vertices->content
+ * @graph: the graph to set up
+ * @edges: a pointer set to the block of edges
+ * Return: 1 on success, 0 on failure
+ */
+
+static int grid_create(graph_t *graph, edge_t **edges)
+{
+	size_t n = CHECK_SIDE * CHECK_SIDE, i, k = 0;
+	unsigned long seed = 1;
+	vertex_t *v = calloc(n, sizeof(vertex_t));
+	char *labels = malloc(n * 16);
+
+	*edges = malloc(4 * n * sizeof(edge_t));
+	graph->nb_vertices = n, graph->vertices = v;
+	if (!v || !*edges || !labels)
+		return (free(v), free(*edges), free(labels), 0);
+	for (i = 0; i < n; i++)
+	{
+		v[i].index = i, v[i].content = labels + 16 * i;
+		v[i].x = i % CHECK_SIDE, v[i].y = i / CHECK_SIDE;
+		sprintf(v[i].content, "%d,%d", v[i].x, v[i].y);
+		v[i].next = i + 1 < n ? v + i + 1 : NULL;
+	}
+	for (i = n; i-- > 0;)
+	{
+		seed = seed * 1103515245 + 12345;
+		if (v[i].x + 1 < CHECK_SIDE)
+			grid_link(v + i, v + i + 1, *edges + k,
+				  1 + (seed >> 16) % 9), k += 2;
+		seed = seed * 1103515245 + 12345;
+		if (i + CHECK_SIDE < n)
+			grid_link(v + i, v + i + CHECK_SIDE, *edges + k,
+				  1 + (seed >> 16) % 9), k += 2;
+	}
+	return (1);
+}
+
+/**
+ * same_path - compares two paths, freeing both
+ * @a: the first path
+ * @b: the second path
+ * Return: 1 if both exist and hold the same contents, 0 otherwise
+ */
+
+static int same_path(queue_t *a, queue_t *b)
+{
+	char *x = NULL, *y = NULL;
+	int same = a && b;
+
+	while (a && b && (x = dequeue(a), y = dequeue(b), x || y))
+	{
+		if (!x || !y || strcmp(x, y))
+			same = 0;
+		free(x), free(y);
+	}
+	while (a && (x = dequeue(a)))
+		free(x);
+	while (b && (y = dequeue(b)))
+		free(y);
+	free(a), free(b);
+
+	return (same);
+}
+
+/**
+ * check_round_trip - checks that a mapped graph file holds the weights and
+ * coordinates of its graph, and that dijkstra_graph_csr finds the same
+ * paths on the mapping as on the snapshot the file was written from
+ * @csr: the snapshot
+ * @map: the mapping of its file
+ * Return: the number of mismatches
+ */
+
+static size_t check_round_trip(const graph_csr_t *csr, const graph_csr_t *map)
+{
+	size_t n = csr->nb_vertices, bad = 0, i, s, t;
+	unsigned long seed = 7;
+
+	if (map->nb_vertices != n || map->nb_edges != csr->nb_edges ||
+	    !map->weights || !map->xs || !map->ys ||
+	    memcmp(map->weights, csr->weights, csr->nb_edges * sizeof(int)) ||
+	    memcmp(map->xs, csr->xs, n * sizeof(int)) ||
+	    memcmp(map->ys, csr->ys, n * sizeof(int)))
+		return (1);
+	for (i = 0; i < CHECK_PAIRS; i++)
+	{
+		seed = seed * 1103515245 + 12345, s = (seed >> 8) % n;
+		seed = seed * 1103515245 + 12345, t = (seed >> 8) % n;
+		bad += !same_path(dijkstra_graph_csr(csr, s, t),
+				  dijkstra_graph_csr(map, s, t));
+	}
+	return (bad);
+}
+
+/**
+ * main - saves a weighted grid, maps its file back and checks that the
+ * path searches agree on both
+ * Return: 0 if the round trip holds, 1 otherwise
+ */
+
+int main(void)
+{
+	graph_t graph;
+	graph_csr_t *csr, *map = NULL;
+	edge_t *edges;
+	size_t bad = 1;
+
+	if (!grid_create(&graph, &edges))
+		return (1);
+	csr = graph_freeze(&graph);
+	if (csr && graph_save(&graph, CHECK_FILE))
+		map = graph_csr_map(CHECK_FILE);
+	if (map)
+		bad = check_round_trip(csr, map);
+	printf("round trip: %s\n", bad ? "FAILED" : "OK");
+
+	graph_csr_unmap(map);
+	graph_csr_delete(csr);
+	remove(CHECK_FILE);
+	free(graph.vertices->content), free(edges), free(graph.vertices);
+	return (bad != 0);
+}
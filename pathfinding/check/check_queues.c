@@ -0,0 +1,82 @@
+#include "pathfinding.h"
+
+/*
+ * The pathfinding project links against the queues library of its
+ * exercises, which is not part of the tree; these are enough for the
+ * searches the round-trip check runs
+ */
+
+/**
+ * queue_create - allocates an empty queue
+ * Return: a pointer to the queue, or NULL on failure
+ */
+
+queue_t *queue_create(void)
+{
+	return (calloc(1, sizeof(queue_t)));
+}
+
+/**
+ * queue_push_front - pushes a pointer at the front of a queue
+ * @queue: the queue
+ * @ptr: the pointer
+ * Return: a pointer to the new node, or NULL on failure
+ */
+
+queue_node_t *queue_push_front(queue_t *queue, void *ptr)
+{
+	queue_node_t *node = calloc(1, sizeof(queue_node_t));
+
+	if (!node)
+		return (NULL);
+
+	node->ptr = ptr;
+	node->next = queue->front;
+	if (queue->front)
+		queue->front->prev = node;
+	else
+		queue->back = node;
+	queue->front = node;
+
+	return (node);
+}
+
+/**
+ * dequeue - pops the pointer at the front of a queue
+ * @queue: the queue
+ * Return: the pointer, or NULL if the queue is empty
+ */
+
+void *dequeue(queue_t *queue)
+{
+	queue_node_t *node = queue->front;
+	void *ptr;
+
+	if (!node)
+		return (NULL);
+
+	ptr = node->ptr;
+	queue->front = node->next;
+	if (queue->front)
+		queue->front->prev = NULL;
+	else
+		queue->back = NULL;
+	free(node);
+
+	return (ptr);
+}
+
+/**
+ * queue_delete - frees a queue and its nodes, but not their pointers
+ * @queue: the queue
+ */
+
+void queue_delete(queue_t *queue)
+{
+	if (!queue)
+		return;
+
+	while (queue->front)
+		dequeue(queue);
+	free(queue);
+}
@@ -0,0 +1,153 @@
+#include "pathfinding.h"
+
+/**
+ * heap_push - pushes an entry in the binary min-heap of dijkstra_graph_csr
+ * @heap: the heap array, large enough for one more entry
+ * @size: pointer to the number of entries in the heap
+ * @dist: distance of the vertex
+ * @v: index of the vertex
+ */
+static void heap_push(csr_heap_entry_t *heap, size_t *size, long dist,
+	size_t v)
+{
+	size_t i = (*size)++;
+	csr_heap_entry_t tmp;
+
+	heap[i].dist = dist, heap[i].v = v;
+	while (i > 0 && heap[(i - 1) / 2].dist > heap[i].dist)
+	{
+		tmp = heap[i], heap[i] = heap[(i - 1) / 2];
+		heap[(i - 1) / 2] = tmp, i = (i - 1) / 2;
+	}
+}
+
+/**
+ * heap_pop - pops the closest entry of the binary min-heap
+ * @heap: the heap array
+ * @size: pointer to the number of entries in the heap, not zero
+ * Return: the closest entry
+ */
+static csr_heap_entry_t heap_pop(csr_heap_entry_t *heap, size_t *size)
+{
+	csr_heap_entry_t top = heap[0], tmp;
+	size_t i = 0, c;
+
+	heap[0] = heap[--(*size)];
+	while ((c = 2 * i + 1) < *size)
+	{
+		if (c + 1 < *size && heap[c + 1].dist < heap[c].dist)
+			c++;
+		if (heap[i].dist <= heap[c].dist)
+			break;
+		tmp = heap[i], heap[i] = heap[c], heap[c] = tmp, i = c;
+	}
+	return (top);
+}
+
+/**
+ * csr_path - builds the queue of contents from start to target
+ * @csr: the snapshot
+ * @from: previous vertex of each vertex on its shortest path
+ * @start: index of the start vertex
+ * @target: index of the target vertex
+ * Return: the path queue, or NULL on failure
+ */
+static queue_t *csr_path(graph_csr_t const *csr, size_t const *from,
+	size_t start, size_t target)
+{
+	queue_t *path = queue_create();
+	char *str;
+	size_t v = target;
+
+	while (path)
+	{
+		str = strdup(graph_csr_label(csr, v));
+		if (!str || !queue_push_front(path, str))
+		{
+			free(str);
+			while ((str = dequeue(path)))
+				free(str);
+			return (free(path), NULL);
+		}
+		if (v == start)
+			break;
+		v = from[v];
+	}
+	return (path);
+}
+
+/**
+ * csr_relax - settles a vertex and pushes its improved neighbours
+ * @csr: the snapshot
+ * @dists: tentative distance of each vertex, -1 if unreached
+ * @from: previous vertex of each vertex on its shortest path
+ * @heap: the heap
+ * @size: pointer to the number of entries in the heap
+ * @top: the entry of the vertex to settle
+ */
+static void csr_relax(graph_csr_t const *csr, long *dists, size_t *from,
+	csr_heap_entry_t *heap, size_t *size, csr_heap_entry_t top)
+{
+	size_t e, w;
+	long dist;
+
+	STATS_ADD(edges_scanned, csr->offsets[top.v + 1] - csr->offsets[top.v]);
+	for (e = csr->offsets[top.v]; e < csr->offsets[top.v + 1]; e++)
+	{
+		w = csr->dests[e], dist = top.dist + csr->weights[e];
+		if (dists[w] < 0 || dist < dists[w])
+		{
+			dists[w] = dist, from[w] = top.v;
+			heap_push(heap, size, dist, w);
+		}
+	}
+	STATS_PEAK(*size);
+}
+
+/**
+ * dijkstra_graph_csr - uses Dijkstra's Algo with a binary heap to find
+ * the shortest path in a compressed-sparse-row snapshot
+ * @csr: pointer to the snapshot
+ * @start: index of the starting vertex
+ * @target: index of the target vertex
+ * Return: path queue or NULL, also if the snapshot has no weights
+ */
+queue_t *dijkstra_graph_csr(graph_csr_t const *csr, size_t start,
+	size_t target)
+{
+	long *dists;
+	size_t *from, size = 0, e;
+	csr_heap_entry_t *heap, top;
+	queue_t *path = NULL;
+
+	if (!csr || !csr->weights || start >= csr->nb_vertices ||
+		target >= csr->nb_vertices)
+		return (NULL);
+	dists = malloc(csr->nb_vertices * sizeof(*dists));
+	from = malloc(csr->nb_vertices * sizeof(*from));
+	heap = malloc((csr->nb_edges + 1) * sizeof(*heap));
+	if (!dists || !from || !heap)
+		return (free(dists), free(from), free(heap), NULL);
+	STATS_BEGIN(GRAPH_PHASE_SEARCH);
+	STATS_ADD(bytes_allocated, csr->nb_vertices * (sizeof(*dists) +
+		sizeof(*from)) + (csr->nb_edges + 1) * sizeof(*heap));
+	for (e = 0; e < csr->nb_vertices; e++)
+		dists[e] = -1;
+	dists[start] = 0, heap_push(heap, &size, 0, start);
+	while (size > 0)
+	{
+		top = heap_pop(heap, &size);
+		if (top.dist > dists[top.v])
+			continue;
+		STATS_ADD(vertices_visited, 1);
+		if (top.v == target)
+		{
+			path = csr_path(csr, from, start, target);
+			break;
+		}
+		csr_relax(csr, dists, from, heap, &size, top);
+	}
+	STATS_END(GRAPH_PHASE_SEARCH);
+	free(dists), free(from), free(heap);
+	return (path);
+}
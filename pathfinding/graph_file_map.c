@@ -0,0 +1,2 @@
+/* Builds the binary graph file mapping of the graphs project */
+#include "../graphs/graph_file_map.c"
@@ -0,0 +1,107 @@
+#include "pathfinding.h"
+
+/**
+ * graph_csr_delete - frees a compressed-sparse-row snapshot
+ * @csr: the snapshot to free
+ */
+void graph_csr_delete(graph_csr_t *csr)
+{
+	if (!csr)
+		return;
+	if (csr->mapping)
+	{
+		graph_csr_unmap(csr);
+		return;
+	}
+
+	free(csr->offsets), free(csr->dests), free(csr->weights);
+	free(csr->label_offsets), free(csr->labels);
+	free(csr->in_offsets), free(csr->in_srcs);
+	free(csr->xs), free(csr->ys);
+	free(csr);
+}
+
+/**
+ * graph_csr_label - gets the content of a vertex of a snapshot
+ * @csr: the snapshot
+ * @v: the index of the vertex
+ * Return: the content of the vertex
+ */
+char const *graph_csr_label(graph_csr_t const *csr, size_t v)
+{
+	return (csr->labels + csr->label_offsets[v]);
+}
+
+/**
+ * csr_alloc - allocates the arrays of a weighted snapshot
+ * @nb_vertices: number of vertices
+ * @nb_edges: number of edges
+ * @labels_size: total size of the vertices contents, NUL bytes included
+ * Return: the snapshot, or NULL on failure
+ */
+static graph_csr_t *csr_alloc(size_t nb_vertices, size_t nb_edges,
+	size_t labels_size)
+{
+	graph_csr_t *csr = calloc(1, sizeof(*csr));
+
+	if (!csr)
+		return (NULL);
+	csr->nb_vertices = nb_vertices, csr->nb_edges = nb_edges;
+	csr->offsets = malloc((nb_vertices + 1) * sizeof(*csr->offsets));
+	csr->dests = malloc((nb_edges + 1) * sizeof(*csr->dests));
+	csr->weights = malloc((nb_edges + 1) * sizeof(*csr->weights));
+	csr->label_offsets = malloc((nb_vertices + 1) *
+		sizeof(*csr->label_offsets));
+	csr->labels = malloc(labels_size + 1);
+	csr->xs = malloc((nb_vertices + 1) * sizeof(*csr->xs));
+	csr->ys = malloc((nb_vertices + 1) * sizeof(*csr->ys));
+	if (!csr->offsets || !csr->dests || !csr->weights ||
+		!csr->label_offsets || !csr->labels || !csr->xs || !csr->ys)
+		return (graph_csr_delete(csr), NULL);
+	STATS_ADD(bytes_allocated, (nb_vertices + 1) * (sizeof(*csr->offsets) +
+		sizeof(*csr->label_offsets) + sizeof(*csr->xs) +
+		sizeof(*csr->ys)) + (nb_edges + 1) * (sizeof(*csr->dests) +
+		sizeof(*csr->weights)) + labels_size + 1);
+	return (csr);
+}
+
+/**
+ * graph_freeze - builds a weighted compressed-sparse-row snapshot
+ * @graph: pointer to graph struct
+ * Return: the snapshot, or NULL on failure
+ */
+graph_csr_t *graph_freeze(graph_t const *graph)
+{
+	graph_csr_t *csr;
+	vertex_t *v;
+	edge_t *e;
+	size_t nb_edges = 0, labels_size = 0, i = 0, l = 0, len;
+
+	if (!graph)
+		return (NULL);
+	STATS_BEGIN(GRAPH_PHASE_FREEZE);
+	for (v = graph->vertices; v; v = v->next)
+		nb_edges += v->nb_edges, labels_size += strlen(v->content) + 1;
+	csr = csr_alloc(graph->nb_vertices, nb_edges, labels_size);
+	if (!csr)
+	{
+		STATS_END(GRAPH_PHASE_FREEZE);
+		return (NULL);
+	}
+	for (v = graph->vertices; v; v = v->next)
+	{
+		csr->offsets[v->index] = i;
+		for (e = v->edges; e; e = e->next, i++)
+		{
+			csr->dests[i] = e->dest->index;
+			csr->weights[i] = e->weight;
+		}
+		len = strlen(v->content) + 1;
+		memcpy(csr->labels + l, v->content, len);
+		csr->label_offsets[v->index] = l, l += len;
+		csr->xs[v->index] = v->x, csr->ys[v->index] = v->y;
+	}
+	csr->offsets[graph->nb_vertices] = i;
+	STATS_END(GRAPH_PHASE_FREEZE);
+	return (csr);
+}
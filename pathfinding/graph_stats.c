@@ -0,0 +1,2 @@
+/* Builds the counters of the graphs project along with the searches */
+#include "../graphs/graph_stats.c"
@@ -0,0 +1,7 @@
+#ifndef PATHFINDING_GRAPH_STATS_H
+#define PATHFINDING_GRAPH_STATS_H
+
+/* The counters are shared with the graphs project, not copied from it */
+#include "../graphs/graph_stats.h"
+
+#endif /*PATHFINDING_GRAPH_STATS_H*/
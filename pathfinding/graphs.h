@@ -109,6 +109,9 @@ typedef struct graph_s
 	vertex_t	*vertices;
 } graph_t;
 
+/* The snapshots and their binary file are those of the graphs project */
+# include "../graphs/graph_csr.h"
+
 
 /*
  * FUNCTIONS
@@ -161,4 +164,59 @@ void graph_delete(graph_t *graph);
  */
 void graph_display(graph_t const *graph);
 
+/**
+ * graph_freeze - Builds a compressed-sparse-row snapshot of a graph, with
+ * the weights of its edges and the coordinates of its vertices
+ *
+ * @graph: Pointer to the graph to snapshot
+ *
+ * Return: A pointer to the snapshot, NULL on failure
+ */
+graph_csr_t *graph_freeze(graph_t const *graph);
+
+/**
+ * graph_csr_delete - Deallocates a compressed-sparse-row snapshot
+ *
+ * @csr: Pointer to the snapshot to be deleted
+ */
+void graph_csr_delete(graph_csr_t *csr);
+
+/**
+ * graph_csr_label - Gets the content of a vertex of a snapshot
+ *
+ * @csr: Pointer to the snapshot
+ * @v: Index of the vertex
+ *
+ * Return: The content of the vertex
+ */
+char const *graph_csr_label(graph_csr_t const *csr, size_t v);
+
+/**
+ * graph_save - Writes a graph to a binary graph file, with the weights of
+ * its edges and the coordinates of its vertices
+ *
+ * @graph: Pointer to the graph to write
+ * @path: Path of the file to create
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_save(graph_t const *graph, char const *path);
+
+/**
+ * graph_csr_map - Maps a binary graph file as a read-only snapshot, on
+ * which dijkstra_graph_csr runs without loading the graph
+ *
+ * @path: Path of the file
+ *
+ * Return: A pointer to the snapshot, NULL on failure
+ */
+graph_csr_t *graph_csr_map(char const *path);
+
+/**
+ * graph_csr_unmap - Releases a snapshot returned by graph_csr_map
+ *
+ * @csr: Pointer to the snapshot
+ */
+void graph_csr_unmap(graph_csr_t *csr);
+
 #endif /* !_GRAPHS_H_ */
@@ -3,6 +3,7 @@
 
 #include "queues.h"
 #include "graphs.h"
+#include "graph_stats.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -23,6 +24,20 @@ typedef struct point_s
 
 } point_t;
 
+/**
+* struct csr_heap_entry_s - Entry of the priority queue of dijkstra_graph_csr
+*
+* @dist: Tentative distance of the vertex from the start vertex
+* @v: Index of the vertex in the snapshot
+*/
+typedef struct csr_heap_entry_s
+{
+	long dist;
+
+	size_t v;
+
+} csr_heap_entry_t;
+
 queue_t *backtracking_array(char **map, int rows, int cols,
 
 	point_t const *start, point_t const *target);
@@ -38,4 +53,8 @@ queue_t *dijkstra_graph(graph_t *graph, vertex_t const *start,
 
 	vertex_t const *target);
 
+queue_t *dijkstra_graph_csr(graph_csr_t const *csr, size_t start,
+
+	size_t target);
+
 #endif /*PATHFINDING_H*/